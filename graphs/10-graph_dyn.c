@@ -0,0 +1,213 @@
+#include "graphs.h"
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+
+/* Delays before retrying a failed compaction, doubling from the first */
+#define DYN_RETRY_MIN_MS 1
+#define DYN_RETRY_MAX_MS 1000
+
+/**
+ * dyn_compaction - Merges a frozen log into a new snapshot
+ * @dyn: Pointer to the dynamic graph
+ * @base: Snapshot the log applies to
+ * @frozen: Log to merge
+ *
+ * Description: Nothing but the compaction thread changes @base and
+ * @frozen, so the merge runs without holding the lock, and the lock is
+ * only taken for writing to swap the snapshots
+ *
+ * Return: 1 if the log was merged, 0 if it is still frozen
+ */
+static int dyn_compaction(graph_dyn_t *dyn, graph_csr_t *base,
+		delta_log_t *frozen)
+{
+	graph_csr_t *merged;
+
+	merged = delta_log_merge(base, frozen);
+	if (merged)
+	{
+		pthread_rwlock_wrlock(&dyn->lock);
+		dyn->base = merged;
+		dyn->frozen = NULL;
+		dyn->nb_compactions++;
+		pthread_rwlock_unlock(&dyn->lock);
+		graph_csr_delete(base);
+		delta_log_delete(frozen);
+	}
+	pthread_mutex_lock(&dyn->wakeup_lock);
+	dyn->nb_attempts++;
+	pthread_cond_broadcast(&dyn->done);
+	pthread_mutex_unlock(&dyn->wakeup_lock);
+	return (merged != NULL);
+}
+
+/**
+ * dyn_worker - Runs the compactions of a dynamic graph
+ * @arg: Pointer to the dynamic graph
+ *
+ * Description: A failed merge leaves the log frozen, which keeps the
+ * next ones from being frozen, so it is retried on its own after a delay
+ * doubling up to DYN_RETRY_MAX_MS, or at once on graph_dyn_compact
+ *
+ * Return: NULL
+ */
+static void *dyn_worker(void *arg)
+{
+	graph_dyn_t *dyn = arg;
+	graph_csr_t *base;
+	delta_log_t *frozen;
+	struct timespec when;
+	long retry = 0;
+
+	pthread_mutex_lock(&dyn->wakeup_lock);
+	while (!dyn->stop)
+	{
+		if (!dyn->pending && !retry)
+		{
+			pthread_cond_wait(&dyn->wakeup, &dyn->wakeup_lock);
+			continue;
+		}
+		if (!dyn->pending)
+		{
+			clock_gettime(CLOCK_REALTIME, &when);
+			when.tv_sec += retry / 1000;
+			when.tv_nsec += retry % 1000 * 1000000;
+			when.tv_sec += when.tv_nsec / 1000000000;
+			when.tv_nsec %= 1000000000;
+			if (pthread_cond_timedwait(&dyn->wakeup,
+				&dyn->wakeup_lock, &when) != ETIMEDOUT)
+				continue;
+		}
+		dyn->pending = 0;
+		pthread_mutex_unlock(&dyn->wakeup_lock);
+		pthread_rwlock_rdlock(&dyn->lock);
+		base = dyn->base;
+		frozen = dyn->frozen;
+		pthread_rwlock_unlock(&dyn->lock);
+		retry = !frozen || dyn_compaction(dyn, base, frozen) ? 0 :
+			retry ? retry * 2 : DYN_RETRY_MIN_MS;
+		if (retry > DYN_RETRY_MAX_MS)
+			retry = DYN_RETRY_MAX_MS;
+		pthread_mutex_lock(&dyn->wakeup_lock);
+	}
+	pthread_mutex_unlock(&dyn->wakeup_lock);
+	return (NULL);
+}
+
+/**
+ * graph_dyn_create - Creates a dynamic graph from the edges of a graph
+ * @graph: Pointer to the graph
+ * @threshold: Number of changes triggering a compaction, 0 for a default
+ *
+ * Description: The dynamic graph has the same vertices as @graph, by
+ * index, and a copy of its edges. It doesn't follow later changes to
+ * @graph.
+ *
+ * Return: Pointer to the dynamic graph, or NULL on failure
+ */
+graph_dyn_t *graph_dyn_create(const graph_t *graph, size_t threshold)
+{
+	graph_dyn_t *dyn;
+
+	if (!graph)
+		return (NULL);
+	dyn = calloc(1, sizeof(*dyn));
+	if (!dyn)
+		return (NULL);
+	dyn->nb_vertices = graph->nb_vertices;
+	dyn->threshold = threshold ? threshold : GRAPH_DYN_THRESHOLD;
+	dyn->base = graph_csr_create(graph);
+	dyn->active = delta_log_create(graph->nb_vertices);
+	if (!dyn->base || !dyn->active)
+	{
+		graph_csr_delete(dyn->base);
+		delta_log_delete(dyn->active);
+		free(dyn);
+		return (NULL);
+	}
+	pthread_rwlock_init(&dyn->lock, NULL);
+	pthread_mutex_init(&dyn->wakeup_lock, NULL);
+	pthread_cond_init(&dyn->wakeup, NULL);
+	pthread_cond_init(&dyn->done, NULL);
+	if (pthread_create(&dyn->worker, NULL, dyn_worker, dyn))
+	{
+		dyn->stop = 1;
+		graph_dyn_delete(dyn);
+		return (NULL);
+	}
+	return (dyn);
+}
+
+/**
+ * graph_dyn_compact - Merges the pending changes into the snapshot
+ * @dyn: Pointer to the dynamic graph
+ *
+ * Description: Compactions run on their own when enough changes are
+ * logged, this waits for the changes made so far to be merged. If a
+ * compaction is already running, a second one is needed for the changes
+ * made since it started.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_dyn_compact(graph_dyn_t *dyn)
+{
+	delta_log_t *frozen;
+	size_t attempts, round, left;
+
+	if (!dyn)
+		return (0);
+	for (round = 0; round < 2; round++)
+	{
+		pthread_rwlock_wrlock(&dyn->lock);
+		graph_dyn_freeze(dyn, 1);
+		frozen = dyn->frozen;
+		left = dyn->active->size;
+		pthread_rwlock_unlock(&dyn->lock);
+		if (!frozen)
+			return (!left);
+		pthread_mutex_lock(&dyn->wakeup_lock);
+		attempts = dyn->nb_attempts;
+		dyn->pending = 1;
+		pthread_cond_signal(&dyn->wakeup);
+		while (dyn->nb_attempts == attempts)
+			pthread_cond_wait(&dyn->done, &dyn->wakeup_lock);
+		pthread_mutex_unlock(&dyn->wakeup_lock);
+		pthread_rwlock_rdlock(&dyn->lock);
+		frozen = dyn->frozen;
+		left = dyn->active->size;
+		pthread_rwlock_unlock(&dyn->lock);
+		if (frozen || !left)
+			break;
+	}
+	return (!frozen);
+}
+
+/**
+ * graph_dyn_delete - Stops the compactions and deallocates a dynamic graph
+ * @dyn: Pointer to the dynamic graph to delete
+ */
+void graph_dyn_delete(graph_dyn_t *dyn)
+{
+	if (!dyn)
+		return;
+
+	pthread_mutex_lock(&dyn->wakeup_lock);
+	if (!dyn->stop)
+	{
+		dyn->stop = 1;
+		pthread_cond_signal(&dyn->wakeup);
+		pthread_mutex_unlock(&dyn->wakeup_lock);
+		pthread_join(dyn->worker, NULL);
+	}
+	else
+		pthread_mutex_unlock(&dyn->wakeup_lock);
+	graph_csr_delete(dyn->base);
+	delta_log_delete(dyn->frozen);
+	delta_log_delete(dyn->active);
+	pthread_rwlock_destroy(&dyn->lock);
+	pthread_mutex_destroy(&dyn->wakeup_lock);
+	pthread_cond_destroy(&dyn->wakeup);
+	pthread_cond_destroy(&dyn->done);
+	free(dyn);
+}
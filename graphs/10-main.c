@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "graphs.h"
+
+#define NB_VERTICES 20000
+#define NB_EDGES 200000
+#define NB_PENDING 2000
+#define BATCH 1000
+#define NB_TRAVERSALS 10
+
+/**
+ * now - Gets a monotonic time
+ *
+ * Return: Time in seconds
+ */
+double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * insert_edges - Adds random edges to a dynamic graph
+ *
+ * @dyn: Pointer to the dynamic graph
+ * @nb: Number of edges to add
+ *
+ * Return: The slowest average insert time of a batch, in microseconds
+ */
+double insert_edges(graph_dyn_t *dyn, size_t nb)
+{
+    size_t i;
+    double start, batch, worst = 0;
+
+    start = now();
+    for (i = 1; i <= nb; i++)
+    {
+        graph_dyn_add_edge(dyn, rand() % NB_VERTICES, rand() % NB_VERTICES,
+            UNIDIRECTIONAL);
+        if (i % BATCH)
+            continue;
+        batch = (now() - start) * 1e6 / BATCH;
+        if (batch > worst)
+            worst = batch;
+        start = now();
+    }
+    return (worst);
+}
+
+static graph_dyn_t *traversed;
+static size_t nb_linked;
+
+/**
+ * link_back - Traversal action adding an edge from each vertex to the
+ * first one, which the traversal must not hold up
+ *
+ * @index: Index of the visited vertex
+ * @depth: Depth of the vertex
+ */
+void link_back(size_t index, size_t depth)
+{
+    (void)depth;
+    nb_linked += graph_dyn_add_edge(traversed, index, 0, UNIDIRECTIONAL);
+}
+
+/**
+ * main - Entry point
+ *
+ * Measures the insert latency of a dynamic graph while it compacts in
+ * the background, and compares its traversal time with the one of its
+ * frozen snapshot
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    graph_dyn_t *dyn;
+    char name[32];
+    size_t i;
+    double start, worst;
+
+    graph = graph_create();
+    for (i = 0; graph && i < NB_VERTICES; i++)
+    {
+        sprintf(name, "v%lu", i);
+        if (!graph_add_vertex(graph, name))
+            return (EXIT_FAILURE);
+    }
+    dyn = graph_dyn_create(graph, 0);
+    if (!dyn)
+    {
+        fprintf(stderr, "Failed to create dynamic graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    start = now();
+    worst = insert_edges(dyn, NB_EDGES);
+    printf("Inserts: %.3f us average, %.3f us slowest batch\n",
+        (now() - start) * 1e6 / NB_EDGES, worst);
+    graph_dyn_compact(dyn);
+    printf("Compactions: %lu\n", dyn->nb_compactions);
+
+    start = now();
+    for (i = 0; i < NB_TRAVERSALS; i++)
+        graph_csr_breadth_first(dyn->base, i, NULL);
+    printf("Frozen CSR traversal: %.3f ms\n",
+        (now() - start) * 1e3 / NB_TRAVERSALS);
+
+    start = now();
+    for (i = 0; i < NB_TRAVERSALS; i++)
+        graph_dyn_breadth_first(dyn, i, NULL);
+    printf("Dynamic traversal, empty delta: %.3f ms\n",
+        (now() - start) * 1e3 / NB_TRAVERSALS);
+
+    insert_edges(dyn, NB_PENDING);
+    start = now();
+    for (i = 0; i < NB_TRAVERSALS; i++)
+        graph_dyn_breadth_first(dyn, i, NULL);
+    printf("Dynamic traversal, %lu pending changes: %.3f ms\n",
+        dyn->active->size, (now() - start) * 1e3 / NB_TRAVERSALS);
+
+    traversed = dyn;
+    graph_dyn_breadth_first(dyn, 0, link_back);
+    printf("Traversal adding an edge per vertex: %lu edges added\n",
+        nb_linked);
+
+    graph_dyn_delete(dyn);
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
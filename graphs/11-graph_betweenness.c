@@ -0,0 +1,214 @@
+#include "graphs.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define UNVISITED ((size_t)-1)
+
+/**
+ * struct brandes_task_s - Share of the sources given to a thread, with
+ * its own buffers
+ *
+ * @csr: Snapshot of the graph
+ * @sources: Table of all the sources
+ * @nb_sources: Number of sources
+ * @first: Position of the first source of the thread in @sources
+ * @stride: Distance between two sources of the thread in @sources
+ * @centrality: Centrality accumulated by the thread
+ * @sigma: Number of shortest paths from the source to each vertex
+ * @delta: Dependency of the source on each vertex
+ * @dist: Distance from the source to each vertex
+ * @order: Vertices in the order they were reached
+ * @threaded: Set if the task runs in a thread of its own
+ */
+typedef struct brandes_task_s
+{
+	const graph_csr_t *csr;
+	const size_t *sources;
+	size_t nb_sources;
+	size_t first;
+	size_t stride;
+	double *centrality;
+	double *sigma;
+	double *delta;
+	size_t *dist;
+	size_t *order;
+	int threaded;
+} brandes_task_t;
+
+/**
+ * brandes_source - Adds the dependencies of one source to the centrality
+ * @task: Pointer to the thread's task
+ * @s: Index of the source
+ *
+ * Description: A breadth-first search counts the shortest paths from @s,
+ * then the vertices are taken back in reverse order to accumulate the
+ * dependencies. Only outgoing edges are needed: the successors of a
+ * vertex on shortest paths are the neighbors one step farther.
+ */
+static void brandes_source(brandes_task_t *task, size_t s)
+{
+	const graph_csr_t *csr = task->csr;
+	size_t head = 0, tail = 0, v, w, i;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		task->dist[v] = UNVISITED;
+		task->sigma[v] = 0;
+		task->delta[v] = 0;
+	}
+	task->dist[s] = 0;
+	task->sigma[s] = 1;
+	task->order[tail++] = s;
+	while (head < tail)
+	{
+		v = task->order[head++];
+		for (i = csr->offsets[v]; i < csr->offsets[v + 1]; i++)
+		{
+			w = csr->targets[i];
+			if (task->dist[w] == UNVISITED)
+			{
+				task->dist[w] = task->dist[v] + 1;
+				task->order[tail++] = w;
+			}
+			if (task->dist[w] == task->dist[v] + 1)
+				task->sigma[w] += task->sigma[v];
+		}
+	}
+	while (tail--)
+	{
+		v = task->order[tail];
+		for (i = csr->offsets[v]; i < csr->offsets[v + 1]; i++)
+		{
+			w = csr->targets[i];
+			if (task->dist[w] == task->dist[v] + 1)
+				task->delta[v] += task->sigma[v] /
+					task->sigma[w] * (1 + task->delta[w]);
+		}
+		if (v != s)
+			task->centrality[v] += task->delta[v];
+	}
+}
+
+/**
+ * brandes_worker - Processes the sources of a thread
+ * @arg: Pointer to the thread's task
+ *
+ * Return: NULL
+ */
+static void *brandes_worker(void *arg)
+{
+	brandes_task_t *task = arg;
+	size_t i;
+
+	for (i = task->first; i < task->nb_sources; i += task->stride)
+		brandes_source(task, task->sources[i]);
+	return (NULL);
+}
+
+/**
+ * pick_sources - Chooses the sources the centrality is computed from
+ * @n: Number of vertices
+ * @sample_k: Number of sources to draw at random, 0 to take them all
+ * @nb_sources: Receives the number of sources
+ *
+ * Description: Sources are drawn without replacement by a partial
+ * Fisher-Yates shuffle, with a fixed seed so results are repeatable
+ *
+ * Return: Table of the sources, or NULL on failure
+ */
+static size_t *pick_sources(size_t n, size_t sample_k, size_t *nb_sources)
+{
+	size_t *sources, i, j, tmp;
+	unsigned long state = 88172645463325252UL;
+
+	sources = malloc(sizeof(*sources) * (n + 1));
+	if (!sources)
+		return (NULL);
+	for (i = 0; i < n; i++)
+		sources[i] = i;
+	*nb_sources = sample_k && sample_k < n ? sample_k : n;
+	for (i = 0; *nb_sources < n && i < *nb_sources; i++)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		j = i + state % (n - i);
+		tmp = sources[i];
+		sources[i] = sources[j];
+		sources[j] = tmp;
+	}
+	return (sources);
+}
+
+/**
+ * graph_betweenness - Computes the betweenness centrality of the vertices
+ * of a graph, using Brandes' algorithm
+ * @graph: Pointer to the graph
+ * @nthreads: Number of threads to spread the sources on, 0 for 1
+ * @sample_k: Number of sources to sample for an approximate result, 0 to
+ *   use every vertex as a source
+ *
+ * Description: The graph is read through a CSR snapshot. Each thread
+ * accumulates in its own buffers, which are summed at the end. When
+ * sampling, the result is scaled by nb_vertices / @sample_k to estimate
+ * the exact centrality.
+ *
+ * Return: Table of the centrality of each vertex, by index, to be freed
+ * by the caller, or NULL on failure
+ */
+double *graph_betweenness(const graph_t *graph, size_t nthreads,
+		size_t sample_k)
+{
+	graph_csr_t *csr;
+	brandes_task_t *tasks;
+	pthread_t *threads;
+	double *centrality = NULL, *buffers;
+	size_t *sources, *indexes, nb_sources = 0, n, t, v;
+
+	if (!graph || !graph->nb_vertices)
+		return (NULL);
+	n = graph->nb_vertices;
+	nthreads = nthreads ? nthreads : 1;
+	csr = graph_csr_create(graph);
+	sources = pick_sources(n, sample_k, &nb_sources);
+	tasks = malloc(sizeof(*tasks) * nthreads);
+	threads = malloc(sizeof(*threads) * nthreads);
+	buffers = malloc(sizeof(*buffers) * n * 3 * nthreads);
+	indexes = malloc(sizeof(*indexes) * n * 2 * nthreads);
+	if (csr && sources && tasks && threads && buffers && indexes)
+		centrality = calloc(n, sizeof(*centrality));
+	for (t = 0; centrality && t < nthreads; t++)
+	{
+		tasks[t].csr = csr;
+		tasks[t].sources = sources;
+		tasks[t].nb_sources = nb_sources;
+		tasks[t].first = t;
+		tasks[t].stride = nthreads;
+		tasks[t].centrality = buffers + n * 3 * t;
+		tasks[t].sigma = tasks[t].centrality + n;
+		tasks[t].delta = tasks[t].sigma + n;
+		tasks[t].dist = indexes + n * 2 * t;
+		tasks[t].order = tasks[t].dist + n;
+		memset(tasks[t].centrality, 0, sizeof(double) * n);
+		tasks[t].threaded = t && !pthread_create(&threads[t], NULL,
+			brandes_worker, &tasks[t]);
+	}
+	for (t = 0; centrality && t < nthreads; t++)
+		if (!tasks[t].threaded)
+			brandes_worker(&tasks[t]);
+	for (t = 0; centrality && t < nthreads; t++)
+	{
+		if (tasks[t].threaded)
+			pthread_join(threads[t], NULL);
+		for (v = 0; v < n; v++)
+			centrality[v] += tasks[t].centrality[v] * n /
+				nb_sources;
+	}
+	graph_csr_delete(csr);
+	free(sources);
+	free(tasks);
+	free(threads);
+	free(buffers);
+	free(indexes);
+	return (centrality);
+}
@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "graphs.h"
+
+#define NB_VERTICES 2000
+#define NB_EDGES 10000
+#define NB_THREADS 4
+#define SAMPLE_K 200
+
+/**
+ * now - Gets a monotonic time
+ *
+ * Return: Time in seconds
+ */
+double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * build_graph - Builds a random graph
+ *
+ * Return: Pointer to the graph, or NULL on failure
+ */
+graph_t *build_graph(void)
+{
+    graph_t *graph;
+    char src[32], dest[32];
+    size_t i;
+
+    graph = graph_create();
+    for (i = 0; graph && i < NB_VERTICES; i++)
+    {
+        sprintf(src, "v%lu", i);
+        if (!graph_add_vertex(graph, src))
+            return (NULL);
+    }
+    for (i = 0; graph && i < NB_EDGES; i++)
+    {
+        sprintf(src, "v%d", rand() % NB_VERTICES);
+        sprintf(dest, "v%d", rand() % NB_VERTICES);
+        if (!graph_add_edge(graph, src, dest, UNIDIRECTIONAL))
+            return (NULL);
+    }
+    return (graph);
+}
+
+/**
+ * main - Entry point
+ *
+ * Measures the speedup of the threaded betweenness centrality over a
+ * single thread, and the error of the sampled approximation
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    double *exact, *parallel, *sampled, start, single, threaded, error = 0;
+    size_t i, top = 0;
+
+    graph = build_graph();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to build graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    start = now();
+    exact = graph_betweenness(graph, 1, 0);
+    single = now() - start;
+    start = now();
+    parallel = graph_betweenness(graph, NB_THREADS, 0);
+    threaded = now() - start;
+    printf("Exact: %.3f s on 1 thread, %.3f s on %d threads (x%.2f)\n",
+        single, threaded, NB_THREADS, single / threaded);
+    start = now();
+    sampled = graph_betweenness(graph, NB_THREADS, SAMPLE_K);
+    printf("Sampled from %d sources: %.3f s\n", SAMPLE_K, now() - start);
+    if (!exact || !parallel || !sampled)
+    {
+        fprintf(stderr, "Failed to compute centrality\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (i = 0; i < NB_VERTICES; i++)
+    {
+        if (exact[i] > exact[top])
+            top = i;
+        error += exact[i] > sampled[i] ?
+            exact[i] - sampled[i] : sampled[i] - exact[i];
+    }
+    printf("Most central: [%lu] %.1f exact, %.1f threaded, %.1f sampled\n",
+        top, exact[top], parallel[top], sampled[top]);
+    printf("Sampling mean absolute error: %.1f\n", error / NB_VERTICES);
+
+    free(exact);
+    free(parallel);
+    free(sampled);
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,208 @@
+#include "graphs.h"
+#include <string.h>
+
+/*
+ * Size of the block malloc takes for a request, as done by glibc on 64-bit
+ * systems: a size_t header, rounded up to 16 bytes, 32 bytes at least
+ */
+#define MALLOC_BLOCK(size) ((size) + sizeof(size_t) <= 32 ? 32 : \
+	((size) + sizeof(size_t) + 15) & ~(size_t)15)
+#define MALLOC_OVERHEAD(size) (MALLOC_BLOCK(size) - (size))
+
+/**
+ * arena_memory - Adds the memory an arena holds without using it to
+ * statistics
+ * @arena: Pointer to the arena
+ * @stats: Pointer to the statistics to add to
+ *
+ * Description: Chunk headers and malloc overhead are counted as overhead,
+ * the room left in the chunks as unused
+ */
+static void arena_memory(const arena_t *arena, graph_memory_stats_t *stats)
+{
+	const arena_chunk_t *chunk;
+	size_t headers = 0;
+
+	for (chunk = arena->chunks; chunk; chunk = chunk->next)
+	{
+		headers += sizeof(*chunk);
+		stats->overhead_bytes += sizeof(*chunk) +
+			MALLOC_OVERHEAD(sizeof(*chunk) + chunk->size);
+	}
+	stats->unused_bytes += arena->reserved - arena->used - headers;
+}
+
+/**
+ * csr_memory - Adds the memory held by a CSR snapshot to statistics
+ * @csr: Pointer to the snapshot
+ * @stats: Pointer to the statistics to add to
+ *
+ * Description: The offsets are counted as vertex bytes, the targets as
+ * edge bytes. The snapshot keeps its maximum degree, so this takes
+ * constant time.
+ */
+static void csr_memory(const graph_csr_t *csr, graph_memory_stats_t *stats)
+{
+	size_t offsets = sizeof(size_t) * (csr->nb_vertices + 1);
+	size_t targets = sizeof(size_t) * (csr->nb_edges + 1);
+
+	stats->vertex_bytes += offsets;
+	stats->edge_bytes += targets - sizeof(size_t);
+	stats->index_bytes += sizeof(*csr);
+	stats->overhead_bytes += sizeof(size_t) +
+		MALLOC_OVERHEAD(sizeof(*csr)) + MALLOC_OVERHEAD(offsets) +
+		MALLOC_OVERHEAD(targets);
+	stats->used_bytes += offsets + targets - sizeof(size_t);
+	stats->reserved_bytes += offsets + targets;
+	stats->nb_vertices = csr->nb_vertices;
+	stats->nb_edges += csr->nb_edges;
+	stats->max_degree = csr->max_degree;
+}
+
+/**
+ * graph_memory_stats - Reports the memory held by a graph
+ * @graph: Pointer to the graph
+ * @stats: Pointer to the statistics to fill in
+ *
+ * Description: Every vertex of the vertex arena is read once to count the
+ * edges and the degrees, so this takes time linear in the number of
+ * vertices, without following the edges lists. Edges are allocated one
+ * by one, their malloc overhead is estimated rather than measured.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_memory_stats(const graph_t *graph, graph_memory_stats_t *stats)
+{
+	const arena_chunk_t *chunk;
+	const vertex_t *vertex, *end;
+	const string_table_t *strings = graph ? graph->strings : NULL;
+	size_t slots;
+
+	if (!graph || !stats)
+		return (0);
+	memset(stats, 0, sizeof(*stats));
+	for (chunk = graph->vertex_arena.chunks; chunk; chunk = chunk->next)
+	{
+		vertex = (const vertex_t *)(chunk + 1);
+		end = vertex + chunk->used / sizeof(*vertex);
+		for (; vertex < end; vertex++)
+		{
+			stats->nb_edges += vertex->nb_edges;
+			if (vertex->nb_edges > stats->max_degree)
+				stats->max_degree = vertex->nb_edges;
+		}
+	}
+	stats->nb_vertices = graph->nb_vertices;
+	stats->vertex_bytes = graph->vertex_arena.used;
+	stats->content_bytes = graph->string_arena.used;
+	stats->edge_bytes = sizeof(edge_t) * stats->nb_edges;
+	stats->index_bytes = sizeof(*graph);
+	stats->overhead_bytes = MALLOC_OVERHEAD(sizeof(*graph)) +
+		MALLOC_OVERHEAD(sizeof(edge_t)) * stats->nb_edges;
+	arena_memory(&graph->vertex_arena, stats);
+	arena_memory(&graph->string_arena, stats);
+	stats->used_bytes = graph->vertex_arena.used + graph->string_arena.used;
+	stats->reserved_bytes = graph->vertex_arena.reserved +
+		graph->string_arena.reserved;
+	if (strings)
+	{
+		slots = sizeof(string_slot_t) * strings->capacity;
+		stats->index_bytes += sizeof(*strings) + slots;
+		stats->overhead_bytes += MALLOC_OVERHEAD(sizeof(*strings)) +
+			MALLOC_OVERHEAD(slots);
+		stats->used_bytes += sizeof(string_slot_t) *
+			strings->nb_strings;
+		stats->reserved_bytes += slots;
+	}
+	stats->total_bytes = stats->vertex_bytes + stats->edge_bytes +
+		stats->content_bytes + stats->index_bytes +
+		stats->overhead_bytes + stats->unused_bytes;
+	if (stats->nb_vertices)
+		stats->avg_degree = (double)stats->nb_edges /
+			stats->nb_vertices;
+	return (1);
+}
+
+/**
+ * graph_csr_memory_stats - Reports the memory held by a CSR snapshot
+ * @csr: Pointer to the snapshot
+ * @stats: Pointer to the statistics to fill in
+ *
+ * Description: A snapshot has no contents, it refers to the vertices of
+ * the graph it was taken from by index. This takes constant time.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_csr_memory_stats(const graph_csr_t *csr,
+		graph_memory_stats_t *stats)
+{
+	if (!csr || !stats)
+		return (0);
+	memset(stats, 0, sizeof(*stats));
+	csr_memory(csr, stats);
+	stats->total_bytes = stats->vertex_bytes + stats->edge_bytes +
+		stats->index_bytes + stats->overhead_bytes;
+	if (stats->nb_vertices)
+		stats->avg_degree = (double)stats->nb_edges /
+			stats->nb_vertices;
+	return (1);
+}
+
+/**
+ * graph_dyn_memory_stats - Reports the memory held by a dynamic graph
+ * @dyn: Pointer to the dynamic graph
+ * @stats: Pointer to the statistics to fill in
+ *
+ * Description: The snapshot and the logs are counted under the lock, so
+ * they are consistent with each other, from the sizes and counters they
+ * keep: the lock is held for a constant time, whatever the size of the
+ * graph. Log entries are counted as edge bytes, and the room left for
+ * more as unused bytes. The maximum degree is the largest one the snapshot
+ * or an added edge brought a vertex to: edges removed since are not
+ * accounted for, so it is an upper bound once edges were removed.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_dyn_memory_stats(graph_dyn_t *dyn, graph_memory_stats_t *stats)
+{
+	const delta_log_t *logs[2];
+	size_t heads = sizeof(size_t) * (dyn ? dyn->nb_vertices + 1 : 0);
+	size_t nets = sizeof(long) * (dyn ? dyn->nb_vertices + 1 : 0);
+	size_t l, size, capacity;
+
+	if (!dyn || !stats)
+		return (0);
+	memset(stats, 0, sizeof(*stats));
+	pthread_rwlock_rdlock(&dyn->lock);
+	csr_memory(dyn->base, stats);
+	logs[0] = dyn->frozen;
+	logs[1] = dyn->active;
+	for (l = 0; l < 2; l++)
+	{
+		if (!logs[l])
+			continue;
+		size = sizeof(delta_entry_t) * logs[l]->size;
+		capacity = sizeof(delta_entry_t) * logs[l]->capacity;
+		stats->edge_bytes += size;
+		stats->index_bytes += sizeof(*logs[l]) + heads + nets;
+		stats->overhead_bytes += MALLOC_OVERHEAD(sizeof(*logs[l])) +
+			MALLOC_OVERHEAD(heads) + MALLOC_OVERHEAD(nets) +
+			MALLOC_OVERHEAD(capacity);
+		stats->unused_bytes += capacity - size;
+		stats->used_bytes += size + heads + nets;
+		stats->reserved_bytes += capacity + heads + nets;
+		stats->nb_edges += logs[l]->nb_adds - logs[l]->nb_removes;
+		if (logs[l]->max_degree > stats->max_degree)
+			stats->max_degree = logs[l]->max_degree;
+	}
+	pthread_rwlock_unlock(&dyn->lock);
+	stats->index_bytes += sizeof(*dyn);
+	stats->overhead_bytes += MALLOC_OVERHEAD(sizeof(*dyn));
+	stats->total_bytes = stats->vertex_bytes + stats->edge_bytes +
+		stats->index_bytes + stats->overhead_bytes +
+		stats->unused_bytes;
+	if (stats->nb_vertices)
+		stats->avg_degree = (double)stats->nb_edges /
+			stats->nb_vertices;
+	return (1);
+}
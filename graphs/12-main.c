@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <malloc.h>
+
+#include "graphs.h"
+
+#define NB_VERTICES 10000
+#define NB_EDGES 40000
+
+/**
+ * vertex_name - Gives the name of a vertex, one in four being too long to
+ * be stored inline
+ *
+ * @buf: Buffer receiving the name
+ * @index: Index of the vertex
+ */
+void vertex_name(char *buf, size_t index)
+{
+    sprintf(buf, index % 4 ? "city-%lu" : "a-longer-vertex-name-%lu", index);
+}
+
+/**
+ * print_stats - Prints memory statistics
+ *
+ * @name: Name of what the statistics describe
+ * @stats: Pointer to the statistics
+ */
+void print_stats(const char *name, const graph_memory_stats_t *stats)
+{
+    printf("%s: %lu vertices, %lu edges, degree %.2f avg, %lu max\n", name,
+        stats->nb_vertices, stats->nb_edges, stats->avg_degree,
+        stats->max_degree);
+    printf("  vertices %lu, edges %lu, contents %lu, index %lu, "
+        "overhead %lu, unused %lu\n", stats->vertex_bytes,
+        stats->edge_bytes, stats->content_bytes, stats->index_bytes,
+        stats->overhead_bytes, stats->unused_bytes);
+    printf("  used %lu / reserved %lu, total %lu bytes\n",
+        stats->used_bytes, stats->reserved_bytes, stats->total_bytes);
+}
+
+/**
+ * main - Entry point
+ *
+ * Reports the memory held by a graph, by a CSR snapshot of it and by a
+ * dynamic graph made from it, and checks the total reported for the
+ * graph against what malloc hands out, and the maximum degree reported
+ * for the dynamic graph against the one of its next snapshot
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    graph_csr_t *csr;
+    graph_dyn_t *dyn;
+    graph_memory_stats_t stats;
+    char src[64], dest[64];
+    size_t i, before, max_degree;
+
+    before = mallinfo2().arena;
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+    for (i = 0; i < NB_VERTICES; i++)
+    {
+        vertex_name(src, i);
+        if (!graph_add_vertex(graph, src))
+        {
+            fprintf(stderr, "Failed to add vertex\n");
+            return (EXIT_FAILURE);
+        }
+    }
+    for (i = 0; i < NB_EDGES; i++)
+    {
+        vertex_name(src, i % NB_VERTICES);
+        vertex_name(dest, (i * 7919 + i / NB_VERTICES + 1) % NB_VERTICES);
+        if (!graph_add_edge(graph, src, dest, UNIDIRECTIONAL))
+        {
+            fprintf(stderr, "Failed to add edge\n");
+            return (EXIT_FAILURE);
+        }
+    }
+    graph_memory_stats(graph, &stats);
+    print_stats("Graph", &stats);
+    printf("  malloc arena grew by %lu bytes\n", mallinfo2().arena - before);
+
+    csr = graph_csr_create(graph);
+    dyn = graph_dyn_create(graph, 0);
+    if (!csr || !dyn)
+    {
+        fprintf(stderr, "Failed to create snapshot\n");
+        return (EXIT_FAILURE);
+    }
+    graph_csr_memory_stats(csr, &stats);
+    print_stats("\nSnapshot", &stats);
+
+    for (i = 0; i < 1000; i++)
+        graph_dyn_add_edge(dyn, i, (i * 31) % NB_VERTICES, UNIDIRECTIONAL);
+    graph_dyn_memory_stats(dyn, &stats);
+    print_stats("\nDynamic graph", &stats);
+    max_degree = stats.max_degree;
+    graph_dyn_compact(dyn);
+    graph_dyn_memory_stats(dyn, &stats);
+    printf("  max degree once compacted: %lu (%s)\n", stats.max_degree,
+        stats.max_degree == max_degree ? "same" : "DIFFERENT");
+
+    graph_dyn_delete(dyn);
+    graph_csr_delete(csr);
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -1,6 +1,5 @@
 #include "graphs.h"
 #include <stdlib.h>
-#include <string.h>
 
 /**
  * find_vertex - Finds a vertex in the graph by content
@@ -11,19 +10,10 @@
  */
 vertex_t *find_vertex(const graph_t *graph, const char *content)
 {
-	vertex_t *vertex;
-
 	if (!graph || !content)
 		return (NULL);
 
-	vertex = graph->vertices;
-	while (vertex)
-	{
-		if (strcmp(vertex->content, content) == 0)
-			return (vertex);
-		vertex = vertex->next;
-	}
-	return (NULL);
+	return (graph_vertex_find(graph, content, graph_string_hash(content)));
 }
 
 /**
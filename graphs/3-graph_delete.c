@@ -18,20 +18,17 @@ void free_edges(edge_t *edges)
 }
 
 /**
- * free_vertices - Frees all vertices in the graph
+ * free_vertices - Frees the edges of all vertices in the graph
  * @vertices: Pointer to the first vertex in the list
+ *
+ * Description: The vertices themselves live in the graph's vertex arena
  */
 void free_vertices(vertex_t *vertices)
 {
-	vertex_t *tmp;
-
 	while (vertices)
 	{
-		tmp = vertices;
+		free_edges(vertices->edges);
 		vertices = vertices->next;
-		free_edges(tmp->edges);
-		free(tmp->content);
-		free(tmp);
 	}
 }
 
@@ -45,5 +42,8 @@ void graph_delete(graph_t *graph)
 		return;
 
 	free_vertices(graph->vertices);
+	string_table_delete(graph->strings);
+	arena_clear(&graph->vertex_arena);
+	arena_clear(&graph->string_arena);
 	free(graph);
 }
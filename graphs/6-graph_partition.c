@@ -0,0 +1,316 @@
+#include "graphs.h"
+#include <stdlib.h>
+
+#define PARTITION_SLACK_PERCENT 3
+
+/**
+ * struct refine_task_s - Range of vertices a thread handles in a round of
+ * refinement, with its own buffers
+ *
+ * @offsets: Offsets table of the adjacency
+ * @adj: Neighbors table of the adjacency
+ * @part: Part of each vertex, by index, as of the start of the round
+ * @sizes: Number of vertices in each part, as of the start of the round
+ * @cap: Maximum number of vertices in a part
+ * @first: Index of the first vertex of the range
+ * @last: Index following the last vertex of the range
+ * @score: Scratch table of k counters, all zeroes
+ * @touched: Scratch table of k part numbers
+ * @moves: Moves proposed, as pairs of a vertex and its new part
+ * @nb_moves: Number of moves proposed
+ * @threaded: Set if the task runs in a thread of its own
+ */
+typedef struct refine_task_s
+{
+	const size_t *offsets;
+	const size_t *adj;
+	const size_t *part;
+	const size_t *sizes;
+	size_t cap;
+	size_t first;
+	size_t last;
+	size_t *score;
+	size_t *touched;
+	size_t *moves;
+	size_t nb_moves;
+	int threaded;
+} refine_task_t;
+
+/**
+ * build_neighbors - Builds an undirected adjacency table of a graph
+ * @graph: Pointer to the graph
+ * @offsets: Where to store the offsets table (nb_vertices + 1 entries)
+ * @adj: Where to store the neighbors table
+ *
+ * Description: Each edge is stored in both directions, so that a vertex
+ * is attracted by the parts of the vertices pointing to it as well
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int build_neighbors(const graph_t *graph, size_t **offsets,
+		size_t **adj)
+{
+	vertex_t *v;
+	edge_t *e;
+	size_t i, n = graph->nb_vertices, *fill;
+
+	*offsets = calloc(n + 1, sizeof(**offsets));
+	fill = calloc(n, sizeof(*fill));
+	if (!*offsets || !fill)
+	{
+		free(*offsets);
+		free(fill);
+		return (0);
+	}
+	for (v = graph->vertices; v; v = v->next)
+		for (e = v->edges; e; e = e->next)
+		{
+			(*offsets)[v->index + 1]++;
+			(*offsets)[e->dest->index + 1]++;
+		}
+	for (i = 0; i < n; i++)
+		(*offsets)[i + 1] += (*offsets)[i];
+	*adj = malloc(sizeof(**adj) * ((*offsets)[n] + 1));
+	if (!*adj)
+	{
+		free(*offsets);
+		free(fill);
+		return (0);
+	}
+	for (v = graph->vertices; v; v = v->next)
+		for (e = v->edges; e; e = e->next)
+		{
+			(*adj)[(*offsets)[v->index] + fill[v->index]++] =
+				e->dest->index;
+			(*adj)[(*offsets)[e->dest->index] +
+				fill[e->dest->index]++] = v->index;
+		}
+	free(fill);
+	return (1);
+}
+
+/**
+ * initial_parts - Splits the breadth first order of a graph in k chunks
+ * @n: Number of vertices
+ * @offsets: Offsets table of the adjacency
+ * @adj: Neighbors table of the adjacency
+ * @k: Number of parts
+ * @part: Part of each vertex, by index
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int initial_parts(size_t n, const size_t *offsets, const size_t *adj,
+		size_t k, size_t *part)
+{
+	size_t *queue, head, tail, root, v, i;
+
+	queue = malloc(sizeof(*queue) * n);
+	if (!queue)
+		return (0);
+	for (v = 0; v < n; v++)
+		part[v] = k;
+	for (root = 0, tail = 0; root < n; root++)
+	{
+		if (part[root] != k)
+			continue;
+		head = tail;
+		queue[tail] = root;
+		part[root] = tail++ * k / n;
+		while (head < tail)
+		{
+			v = queue[head++];
+			for (i = offsets[v]; i < offsets[v + 1]; i++)
+			{
+				if (part[adj[i]] != k)
+					continue;
+				queue[tail] = adj[i];
+				part[adj[i]] = tail++ * k / n;
+			}
+		}
+	}
+	free(queue);
+	return (1);
+}
+
+/**
+ * propose_moves - Chooses where the vertices of a thread's range go, from
+ * the parts at the start of the round
+ * @arg: Pointer to the thread's task
+ *
+ * Description: Each vertex goes to the part most of its neighbors belong
+ * to, if that part has room for it. The parts and sizes are only read,
+ * the moves are stored in the task's own buffer.
+ *
+ * Return: NULL
+ */
+static void *propose_moves(void *arg)
+{
+	refine_task_t *task = arg;
+	const size_t *part = task->part, *adj = task->adj;
+	size_t v, i, best, nb_touched;
+
+	task->nb_moves = 0;
+	for (v = task->first; v < task->last; v++)
+	{
+		nb_touched = 0;
+		for (i = task->offsets[v]; i < task->offsets[v + 1]; i++)
+			if (task->score[part[adj[i]]]++ == 0)
+				task->touched[nb_touched++] = part[adj[i]];
+		best = part[v];
+		for (i = 0; i < nb_touched; i++)
+		{
+			if (task->score[task->touched[i]] > task->score[best] &&
+				task->sizes[task->touched[i]] < task->cap)
+				best = task->touched[i];
+		}
+		for (i = 0; i < nb_touched; i++)
+			task->score[task->touched[i]] = 0;
+		if (best != part[v] && task->sizes[part[v]] > 1)
+		{
+			task->moves[task->nb_moves * 2] = v;
+			task->moves[task->nb_moves++ * 2 + 1] = best;
+		}
+	}
+	return (NULL);
+}
+
+/**
+ * refine_round - Runs a round of label propagation on several threads
+ * @tasks: Tasks of the threads, one range of vertices each
+ * @nb_tasks: Number of tasks
+ * @threads: Room for the thread of each task
+ * @part: Part of each vertex, by index
+ * @sizes: Number of vertices in each part
+ *
+ * Description: Every task proposes its moves from the same state, then,
+ * once all of them are done, the moves are applied in vertex order as
+ * long as the target part has room left and the source part keeps a
+ * vertex. The result doesn't depend on the number of tasks. A task whose
+ * thread can't be started runs on this thread.
+ *
+ * Return: Number of vertices moved
+ */
+static size_t refine_round(refine_task_t *tasks, size_t nb_tasks,
+		pthread_t *threads, size_t *part, size_t *sizes)
+{
+	size_t t, i, v, best, moves = 0;
+
+	for (t = 0; t < nb_tasks; t++)
+		tasks[t].threaded = t && !pthread_create(&threads[t], NULL,
+			propose_moves, &tasks[t]);
+	for (t = 0; t < nb_tasks; t++)
+		if (!tasks[t].threaded)
+			propose_moves(&tasks[t]);
+	for (t = 0; t < nb_tasks; t++)
+		if (tasks[t].threaded)
+			pthread_join(threads[t], NULL);
+	for (t = 0; t < nb_tasks; t++)
+		for (i = 0; i < tasks[t].nb_moves; i++)
+		{
+			v = tasks[t].moves[i * 2];
+			best = tasks[t].moves[i * 2 + 1];
+			if (sizes[best] >= tasks[t].cap || sizes[part[v]] <= 1)
+				continue;
+			sizes[part[v]]--;
+			sizes[best]++;
+			part[v] = best;
+			moves++;
+		}
+	return (moves);
+}
+
+/**
+ * graph_partition - Splits a graph in k balanced parts with few cut edges
+ * @graph: Pointer to the graph to partition, which must not change
+ *   during the call
+ * @k: Number of parts
+ * @options: Threads and stopping rule of refinement, or NULL for one
+ *   thread and at most PARTITION_MAX_ROUNDS rounds
+ * @out_part: Array of nb_vertices entries, receiving the part of each
+ *   vertex, by vertex index
+ * @stats: If not NULL, receives the edge-cut and balance of the result,
+ *   measured with the part sizes refinement keeps, so it can't fail once
+ *   @out_part is written
+ *
+ * Description: The breadth first order of the graph is cut in k chunks,
+ * then refined by size-constrained label propagation: each round moves
+ * vertices to the part of most of their neighbors, without letting a part
+ * grow over PARTITION_SLACK_PERCENT percent above the ideal size. The
+ * graph is only read once, into adjacency tables the threads share, each
+ * of them handling a range of vertices per round. Refinement stops after
+ * a round moving @options->min_moves vertices or fewer, or after
+ * @options->max_rounds rounds: fewer rounds partition faster, with more
+ * cut edges.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_partition(const graph_t *graph, size_t k,
+		const partition_options_t *options, size_t *out_part,
+		partition_stats_t *stats)
+{
+	size_t *offsets = NULL, *adj = NULL, *sizes, *moves, n, v, t, cap;
+	size_t nb_tasks = 1, max_rounds = PARTITION_MAX_ROUNDS, min_moves = 0;
+	size_t rounds = 0, moved = 0, round_moves;
+	refine_task_t *tasks;
+	pthread_t *threads;
+	int ok;
+
+	if (!graph || !k || !out_part)
+		return (0);
+	n = graph->nb_vertices;
+	if (options)
+	{
+		nb_tasks = options->nb_threads ? options->nb_threads : 1;
+		if (options->max_rounds)
+			max_rounds = options->max_rounds;
+		min_moves = options->min_moves;
+	}
+	nb_tasks = n && nb_tasks > n ? n : nb_tasks;
+	if (n && !build_neighbors(graph, &offsets, &adj))
+		return (0);
+	sizes = calloc(k * (1 + nb_tasks * 2), sizeof(*sizes));
+	moves = malloc(sizeof(*moves) * (n * 2 + 1));
+	tasks = malloc(sizeof(*tasks) * nb_tasks);
+	threads = malloc(sizeof(*threads) * nb_tasks);
+	ok = sizes && moves && tasks && threads &&
+		(!n || initial_parts(n, offsets, adj, k, out_part));
+	for (v = 0; ok && v < n; v++)
+		sizes[out_part[v]]++;
+	cap = (n + k - 1) / k;
+	cap += cap * PARTITION_SLACK_PERCENT / 100;
+	for (t = 0; ok && t < nb_tasks; t++)
+	{
+		tasks[t].offsets = offsets;
+		tasks[t].adj = adj;
+		tasks[t].part = out_part;
+		tasks[t].sizes = sizes;
+		tasks[t].cap = cap;
+		tasks[t].first = n * t / nb_tasks;
+		tasks[t].last = n * (t + 1) / nb_tasks;
+		tasks[t].score = sizes + k + k * 2 * t;
+		tasks[t].touched = tasks[t].score + k;
+		tasks[t].moves = moves + tasks[t].first * 2;
+	}
+	while (ok && n && rounds < max_rounds)
+	{
+		round_moves = refine_round(tasks, nb_tasks, threads, out_part,
+			sizes);
+		moved += round_moves;
+		rounds++;
+		if (round_moves <= min_moves)
+			break;
+	}
+	if (ok && stats)
+	{
+		partition_stats_fill(graph, k, out_part, sizes, stats);
+		stats->rounds = rounds;
+		stats->moves = moved;
+	}
+	free(offsets);
+	free(adj);
+	free(sizes);
+	free(moves);
+	free(tasks);
+	free(threads);
+	return (ok);
+}
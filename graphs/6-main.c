@@ -0,0 +1,166 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "graphs.h"
+
+#define NB_VERTICES 20000
+#define NB_COMMUNITIES 16
+#define NB_EDGES 60000
+#define NB_THREADS 4
+
+/**
+ * now - Gets a monotonic time
+ *
+ * Return: Time in seconds
+ */
+double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * build_graph - Builds a random graph of NB_COMMUNITIES communities, nine
+ * edges out of ten staying in their community
+ *
+ * Return: Pointer to the graph, or NULL on failure
+ */
+graph_t *build_graph(void)
+{
+    graph_t *graph;
+    char src[32], dest[32];
+    size_t i, u, size = NB_VERTICES / NB_COMMUNITIES;
+
+    graph = graph_create();
+    for (i = 0; graph && i < NB_VERTICES; i++)
+    {
+        sprintf(src, "v%lu", i * 7919 % NB_VERTICES);
+        if (!graph_add_vertex(graph, src))
+            return (NULL);
+    }
+    for (i = 0; graph && i < NB_EDGES; i++)
+    {
+        u = rand() % NB_VERTICES;
+        sprintf(src, "v%lu", u);
+        sprintf(dest, "v%lu", rand() % 10 ? u / size * size + rand() % size :
+            (size_t)rand() % NB_VERTICES);
+        if (!graph_add_edge(graph, src, dest, UNIDIRECTIONAL))
+            return (NULL);
+    }
+    return (graph);
+}
+
+/**
+ * bench - Partitions a larger graph in 8 parts with different options
+ *
+ * Description: The threaded refinement must give the same parts as a
+ * single thread, and fewer rounds must cut more edges
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int bench(void)
+{
+    partition_options_t options[3] = {{1, 0, 0}, {NB_THREADS, 0, 0},
+        {NB_THREADS, 4, 0}};
+    partition_stats_t stats;
+    graph_t *graph;
+    size_t *parts[3] = {NULL, NULL, NULL}, i;
+    double start;
+    int ok = 1;
+
+    graph = build_graph();
+    if (!graph)
+        return (0);
+    printf("\n%d vertices in %d communities, %d edges\n", NB_VERTICES,
+        NB_COMMUNITIES, NB_EDGES);
+    for (i = 0; i < 3; i++)
+    {
+        parts[i] = malloc(sizeof(size_t) * NB_VERTICES);
+        start = now();
+        ok = parts[i] && graph_partition(graph, 8, &options[i], parts[i],
+            &stats) && ok;
+        if (!ok)
+            break;
+        printf("%lu threads, %2lu rounds max: %.3f s, edge-cut %lu,"
+            " %lu rounds\n", options[i].nb_threads, options[i].max_rounds ?
+            options[i].max_rounds : PARTITION_MAX_ROUNDS, now() - start,
+            stats.edge_cut, stats.rounds);
+    }
+    ok = ok && !memcmp(parts[0], parts[1], sizeof(size_t) * NB_VERTICES);
+    printf("Threaded parts: %s\n", ok ? "identical" : "DIFFERENT");
+    for (i = 0; i < 3; i++)
+        free(parts[i]);
+    graph_delete(graph);
+    return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * Partitions a small graph, then measures the options on a larger one
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    partition_stats_t stats;
+    size_t part[8];
+    vertex_t *v;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edge(graph, "San Francisco", "Las Vegas", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Boston", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Miami", "San Francisco", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Houston", "Seattle", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Chicago", "New York", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Las Vegas", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "New York", "Houston", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Miami", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "San Francisco", "Boston", BIDIRECTIONAL))
+    {
+        fprintf(stderr, "Failed to add edge\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_partition(graph, 2, NULL, part, &stats))
+    {
+        fprintf(stderr, "Failed to partition graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (v = graph->vertices; v; v = v->next)
+        printf("[%lu] %s -> part %lu\n", v->index, v->content, part[v->index]);
+    printf("\nEdge-cut: %lu/%lu\n", stats.edge_cut, stats.nb_edges);
+    printf("Parts: %lu to %lu vertices (imbalance %.2f)\n",
+        stats.min_part, stats.max_part, stats.imbalance);
+    printf("Refinement: %lu rounds, %lu moves\n", stats.rounds, stats.moves);
+
+    graph_delete(graph);
+
+    return (bench() ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,202 @@
+#include "graphs.h"
+#include <stdlib.h>
+
+#define NOT_IN_SHARD ((size_t)-1)
+
+/**
+ * shard_add_vertex - Appends a copy of a vertex to a shard's graph
+ * @graph: Pointer to the shard's graph
+ * @tail: Pointer to the last vertex of the shard's graph, updated
+ * @src: Vertex to copy
+ *
+ * Description: Contents are unique in the source graph already, so the
+ * duplicate check of graph_add_vertex is skipped
+ *
+ * Return: Pointer to the created vertex, or NULL on failure
+ */
+static vertex_t *shard_add_vertex(graph_t *graph, vertex_t **tail,
+		const vertex_t *src)
+{
+	vertex_t *vertex;
+
+	vertex = graph_vertex_new(graph, src->content, src->hash);
+	if (!vertex)
+		return (NULL);
+	graph->nb_vertices++;
+	if (*tail)
+		(*tail)->next = vertex;
+	else
+		graph->vertices = vertex;
+	*tail = vertex;
+	return (vertex);
+}
+
+/**
+ * map_shard - Assigns a local index to the owned and ghost vertices
+ * @shard: Pointer to the shard being built
+ * @vertices: Vertices of the source graph, by index
+ * @n: Number of vertices in the source graph
+ * @part: Part of each vertex, by index
+ * @local: Receives the local index of each vertex, or NOT_IN_SHARD
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int map_shard(graph_shard_t *shard, vertex_t **vertices, size_t n,
+		const size_t *part, size_t *local)
+{
+	size_t i, dest;
+	edge_t *e;
+	ghost_vertex_t *ghost;
+	void *shrunk;
+
+	shard->global_index = malloc(sizeof(size_t) * n);
+	shard->ghosts = malloc(sizeof(ghost_vertex_t) * n);
+	if (!shard->global_index || !shard->ghosts)
+		return (0);
+	for (i = 0; i < n; i++)
+	{
+		local[i] = NOT_IN_SHARD;
+		if (part[i] != shard->part)
+			continue;
+		local[i] = shard->nb_owned;
+		shard->global_index[shard->nb_owned++] = i;
+	}
+	for (i = 0; i < shard->nb_owned; i++)
+	{
+		e = vertices[shard->global_index[i]]->edges;
+		for (; e; e = e->next)
+		{
+			dest = e->dest->index;
+			if (local[dest] != NOT_IN_SHARD)
+				continue;
+			local[dest] = shard->nb_owned + shard->nb_ghosts;
+			ghost = &shard->ghosts[shard->nb_ghosts++];
+			ghost->global_index = dest;
+			ghost->owner = part[dest];
+		}
+	}
+	/* Both tables were sized for the whole graph, give back the excess */
+	shrunk = realloc(shard->global_index, sizeof(size_t) *
+		(shard->nb_owned + 1));
+	if (shrunk)
+		shard->global_index = shrunk;
+	shrunk = realloc(shard->ghosts, sizeof(ghost_vertex_t) *
+		(shard->nb_ghosts + 1));
+	if (shrunk)
+		shard->ghosts = shrunk;
+	return (1);
+}
+
+/**
+ * build_shard_graph - Copies the owned vertices, their edges and the
+ * ghost vertices into the shard's graph
+ * @shard: Pointer to the shard being built
+ * @vertices: Vertices of the source graph, by index
+ * @local: Local index of each vertex of the source graph
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int build_shard_graph(graph_shard_t *shard, vertex_t **vertices,
+		const size_t *local)
+{
+	vertex_t **copies, *tail = NULL;
+	edge_t *e, *copy, **last;
+	size_t i, src, total = shard->nb_owned + shard->nb_ghosts;
+
+	copies = malloc(sizeof(*copies) * (total + 1));
+	if (!copies)
+		return (0);
+	for (i = 0; i < total; i++)
+	{
+		if (i < shard->nb_owned)
+			src = shard->global_index[i];
+		else
+			src = shard->ghosts[i - shard->nb_owned].global_index;
+		copies[i] = shard_add_vertex(shard->graph, &tail,
+			vertices[src]);
+		if (!copies[i])
+		{
+			free(copies);
+			return (0);
+		}
+	}
+	for (i = 0; i < shard->nb_owned; i++)
+	{
+		last = &copies[i]->edges;
+		e = vertices[shard->global_index[i]]->edges;
+		for (; e; e = e->next)
+		{
+			copy = malloc(sizeof(*copy));
+			if (!copy)
+				break;
+			copy->dest = copies[local[e->dest->index]];
+			copy->next = NULL;
+			*last = copy;
+			last = &copy->next;
+			copies[i]->nb_edges++;
+			shard->nb_edges++;
+			shard->edge_cut += copy->dest->index >= shard->nb_owned;
+		}
+		if (e)
+			break;
+	}
+	free(copies);
+	return (i == shard->nb_owned);
+}
+
+/**
+ * graph_extract_shard - Builds the subgraph of one part of a graph
+ * @graph: Pointer to the partitioned graph
+ * @part: Part of each vertex, by vertex index (see graph_partition)
+ * @part_id: Part to extract
+ *
+ * Description: The shard's graph holds a copy of every vertex of the part,
+ * with all their edges. Edges leaving the part point to ghost vertices,
+ * which are copied without edges and listed in the shard's ghost table
+ * along with their global index and owning part.
+ *
+ * Return: Pointer to the created shard, or NULL on failure
+ */
+graph_shard_t *graph_extract_shard(const graph_t *graph, const size_t *part,
+		size_t part_id)
+{
+	graph_shard_t *shard;
+	vertex_t **vertices;
+	size_t *local;
+
+	if (!graph || !part || !graph->nb_vertices)
+		return (NULL);
+	shard = calloc(1, sizeof(*shard));
+	vertices = graph_vertex_array(graph);
+	local = malloc(sizeof(*local) * graph->nb_vertices);
+	if (shard)
+	{
+		shard->part = part_id;
+		shard->graph = graph_create();
+	}
+	if (!shard || !shard->graph || !vertices || !local ||
+		!map_shard(shard, vertices, graph->nb_vertices, part, local) ||
+		!build_shard_graph(shard, vertices, local))
+	{
+		graph_shard_delete(shard);
+		shard = NULL;
+	}
+	free(vertices);
+	free(local);
+	return (shard);
+}
+
+/**
+ * graph_shard_delete - Deallocates a shard
+ * @shard: Pointer to the shard to delete
+ */
+void graph_shard_delete(graph_shard_t *shard)
+{
+	if (!shard)
+		return;
+
+	graph_delete(shard->graph);
+	free(shard->global_index);
+	free(shard->ghosts);
+	free(shard);
+}
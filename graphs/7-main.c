@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    graph_shard_t *shard;
+    size_t part[8], p, i;
+
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_vertex(graph, "San Francisco") ||
+        !graph_add_vertex(graph, "Seattle") ||
+        !graph_add_vertex(graph, "New York") ||
+        !graph_add_vertex(graph, "Miami") ||
+        !graph_add_vertex(graph, "Chicago") ||
+        !graph_add_vertex(graph, "Houston") ||
+        !graph_add_vertex(graph, "Las Vegas") ||
+        !graph_add_vertex(graph, "Boston"))
+    {
+        fprintf(stderr, "Failed to add vertex\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_add_edge(graph, "San Francisco", "Las Vegas", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Boston", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Miami", "San Francisco", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Houston", "Seattle", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Chicago", "New York", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Las Vegas", "New York", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Chicago", UNIDIRECTIONAL) ||
+        !graph_add_edge(graph, "New York", "Houston", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "Seattle", "Miami", BIDIRECTIONAL) ||
+        !graph_add_edge(graph, "San Francisco", "Boston", BIDIRECTIONAL))
+    {
+        fprintf(stderr, "Failed to add edge\n");
+        return (EXIT_FAILURE);
+    }
+
+    if (!graph_partition(graph, 2, NULL, part, NULL))
+    {
+        fprintf(stderr, "Failed to partition graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (p = 0; p < 2; p++)
+    {
+        shard = graph_extract_shard(graph, part, p);
+        if (!shard)
+        {
+            fprintf(stderr, "Failed to extract shard %lu\n", p);
+            return (EXIT_FAILURE);
+        }
+        printf("Shard %lu: %lu owned, %lu ghosts, edge-cut %lu/%lu\n",
+            p, shard->nb_owned, shard->nb_ghosts, shard->edge_cut,
+            shard->nb_edges);
+        graph_display(shard->graph);
+        for (i = 0; i < shard->nb_ghosts; i++)
+            printf("Ghost [%lu] -> global [%lu], part %lu\n",
+                shard->nb_owned + i, shard->ghosts[i].global_index,
+                shard->ghosts[i].owner);
+        printf("\n");
+        graph_shard_delete(shard);
+    }
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <malloc.h>
+#include <time.h>
+
+#include "graphs.h"
+
+#define NB_VERTICES 40000
+#define NB_LOOKUPS 1000
+
+/**
+ * main - Entry point
+ *
+ * Measures the heap memory used per vertex, and the time taken to look up
+ * vertices by content, with a mix of short and long vertex names
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    graph_t *graph;
+    char name[64];
+    size_t i, before, found = 0;
+    clock_t start;
+    double elapsed;
+
+    before = mallinfo2().uordblks;
+    graph = graph_create();
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (i = 0; i < NB_VERTICES; i++)
+    {
+        if (i % 8)
+            sprintf(name, "city-%lu", i);
+        else
+            sprintf(name, "a-much-longer-vertex-name-%lu", i);
+        if (!graph_add_vertex(graph, name))
+        {
+            fprintf(stderr, "Failed to add vertex\n");
+            return (EXIT_FAILURE);
+        }
+    }
+    printf("Memory per vertex: %.1f bytes\n",
+        (double)(mallinfo2().uordblks - before) / NB_VERTICES);
+
+    start = clock();
+    for (i = 0; i < NB_LOOKUPS; i++)
+    {
+        sprintf(name, "city-%lu", (i * 7919) % NB_VERTICES | 1);
+        found += find_vertex(graph, name) != NULL;
+    }
+    elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("Lookups: %lu/%d found, %.2f us per lookup\n",
+        found, NB_LOOKUPS, elapsed * 1e6 / NB_LOOKUPS);
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
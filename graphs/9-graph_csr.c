@@ -0,0 +1,126 @@
+#include "graphs.h"
+#include <stdlib.h>
+
+#define UNVISITED ((size_t)-1)
+
+/**
+ * graph_csr_alloc - Allocates an empty CSR snapshot
+ * @nb_vertices: Number of vertices
+ * @nb_edges: Number of edges
+ *
+ * Return: Pointer to the snapshot, with zeroed offsets, or NULL on failure
+ */
+graph_csr_t *graph_csr_alloc(size_t nb_vertices, size_t nb_edges)
+{
+	graph_csr_t *csr;
+
+	csr = malloc(sizeof(*csr));
+	if (!csr)
+		return (NULL);
+	csr->nb_vertices = nb_vertices;
+	csr->nb_edges = nb_edges;
+	csr->max_degree = 0;
+	csr->offsets = calloc(nb_vertices + 1, sizeof(*csr->offsets));
+	csr->targets = malloc(sizeof(*csr->targets) * (nb_edges + 1));
+	if (!csr->offsets || !csr->targets)
+	{
+		graph_csr_delete(csr);
+		return (NULL);
+	}
+	return (csr);
+}
+
+/**
+ * graph_csr_create - Takes a CSR snapshot of a graph
+ * @graph: Pointer to the graph
+ *
+ * Description: The snapshot doesn't follow later changes to the graph
+ *
+ * Return: Pointer to the snapshot, or NULL on failure
+ */
+graph_csr_t *graph_csr_create(const graph_t *graph)
+{
+	graph_csr_t *csr;
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t nb_edges = 0, i;
+
+	if (!graph)
+		return (NULL);
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		nb_edges += vertex->nb_edges;
+	csr = graph_csr_alloc(graph->nb_vertices, nb_edges);
+	if (!csr)
+		return (NULL);
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		csr->offsets[vertex->index + 1] = vertex->nb_edges;
+		if (vertex->nb_edges > csr->max_degree)
+			csr->max_degree = vertex->nb_edges;
+	}
+	for (i = 0; i < csr->nb_vertices; i++)
+		csr->offsets[i + 1] += csr->offsets[i];
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		i = csr->offsets[vertex->index];
+		for (edge = vertex->edges; edge; edge = edge->next)
+			csr->targets[i++] = edge->dest->index;
+	}
+	return (csr);
+}
+
+/**
+ * graph_csr_delete - Deallocates a CSR snapshot
+ * @csr: Pointer to the snapshot to delete
+ */
+void graph_csr_delete(graph_csr_t *csr)
+{
+	if (!csr)
+		return;
+
+	free(csr->offsets);
+	free(csr->targets);
+	free(csr);
+}
+
+/**
+ * graph_csr_breadth_first - Traverses a CSR snapshot using breadth-first
+ * algorithm
+ * @csr: Pointer to the snapshot to traverse
+ * @start: Index of the vertex to start from
+ * @action: Function to call for each visited vertex, can be NULL
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t graph_csr_breadth_first(const graph_csr_t *csr, size_t start,
+		void (*action)(size_t index, size_t depth))
+{
+	size_t *queue, *depth, head = 0, tail = 0, v, i, max_depth = 0;
+
+	if (!csr || start >= csr->nb_vertices)
+		return (0);
+	queue = malloc(sizeof(*queue) * csr->nb_vertices * 2);
+	if (!queue)
+		return (0);
+	depth = queue + csr->nb_vertices;
+	for (v = 0; v < csr->nb_vertices; v++)
+		depth[v] = UNVISITED;
+	queue[tail++] = start;
+	depth[start] = 0;
+	while (head < tail)
+	{
+		v = queue[head++];
+		if (action)
+			action(v, depth[v]);
+		max_depth = depth[v];
+		for (i = csr->offsets[v]; i < csr->offsets[v + 1]; i++)
+		{
+			if (depth[csr->targets[i]] != UNVISITED)
+				continue;
+			depth[csr->targets[i]] = depth[v] + 1;
+			queue[tail++] = csr->targets[i];
+		}
+	}
+	free(queue);
+	return (max_depth);
+}
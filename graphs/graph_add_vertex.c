@@ -1,6 +1,4 @@
 #include "graphs.h"
-#include <stdlib.h>
-#include <string.h>
 
 /**
  * graph_add_vertex - Adds a vertex to an existing graph
@@ -11,52 +9,29 @@
  */
 vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 {
-    vertex_t *new_vertex, *current;
-    char *str_copy;
+    vertex_t *new_vertex, *last;
+    unsigned long hash;
 
     if (!graph || !str)
         return (NULL);
 
     /* Check if vertex already exists */
-    current = graph->vertices;
-    while (current)
-    {
-        if (strcmp(current->content, str) == 0)
-            return (NULL);
-        current = current->next;
-    }
-
-    /* Create new vertex */
-    str_copy = strdup(str);
-    if (!str_copy)
+    hash = graph_string_hash(str);
+    if (graph_vertex_find(graph, str, hash))
         return (NULL);
 
-    new_vertex = malloc(sizeof(vertex_t));
+    /* Create and initialize new vertex */
+    last = graph_vertex_last(graph);
+    new_vertex = graph_vertex_new(graph, str, hash);
     if (!new_vertex)
-    {
-        free(str_copy);
         return (NULL);
-    }
-
-    /* Initialize vertex */
-    new_vertex->index = graph->nb_vertices;
-    new_vertex->content = str_copy;
-    new_vertex->nb_edges = 0;
-    new_vertex->edges = NULL;
-    new_vertex->next = NULL;
 
     /* Add vertex to graph */
-    if (!graph->vertices)
+    if (!last)
         graph->vertices = new_vertex;
     else
-    {
-        current = graph->vertices;
-        while (current->next)
-            current = current->next;
-        current->next = new_vertex;
-    }
+        last->next = new_vertex;
 
     graph->nb_vertices++;
     return (new_vertex);
 }
-
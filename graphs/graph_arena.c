@@ -0,0 +1,65 @@
+#include "graphs.h"
+#include <stdlib.h>
+
+#define ARENA_CHUNK_SIZE 16384
+
+/**
+ * arena_alloc - Hands out memory from an arena
+ * @arena: Pointer to the arena
+ * @size: Number of bytes needed
+ * @align: Alignment of the returned memory (a power of 2, at most the
+ *   alignment of a pointer)
+ *
+ * Description: Memory is taken from the end of the current chunk, and a
+ * new chunk is allocated when it is full. It is only given back to the
+ * system by arena_clear.
+ *
+ * Return: Pointer to the memory, or NULL on failure
+ */
+void *arena_alloc(arena_t *arena, size_t size, size_t align)
+{
+	arena_chunk_t *chunk;
+	size_t offset, chunk_size;
+
+	if (!arena || !size || !align)
+		return (NULL);
+	chunk = arena->chunks;
+	offset = chunk ? (chunk->used + align - 1) & ~(align - 1) : 0;
+	if (!chunk || offset + size > chunk->size)
+	{
+		chunk_size = size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE;
+		chunk = malloc(sizeof(*chunk) + chunk_size);
+		if (!chunk)
+			return (NULL);
+		chunk->next = arena->chunks;
+		chunk->size = chunk_size;
+		chunk->used = 0;
+		arena->chunks = chunk;
+		arena->reserved += sizeof(*chunk) + chunk_size;
+		offset = 0;
+	}
+	arena->used += size + offset - chunk->used;
+	chunk->used = offset + size;
+	return ((char *)(chunk + 1) + offset);
+}
+
+/**
+ * arena_clear - Gives back all the memory of an arena to the system
+ * @arena: Pointer to the arena
+ */
+void arena_clear(arena_t *arena)
+{
+	arena_chunk_t *chunk;
+
+	if (!arena)
+		return;
+
+	while (arena->chunks)
+	{
+		chunk = arena->chunks;
+		arena->chunks = chunk->next;
+		free(chunk);
+	}
+	arena->reserved = 0;
+	arena->used = 0;
+}
@@ -16,6 +16,13 @@ graph_t *graph_create(void)
 
     graph->nb_vertices = 0;
     graph->vertices = NULL;
+    graph->vertex_arena.chunks = NULL;
+    graph->vertex_arena.reserved = 0;
+    graph->vertex_arena.used = 0;
+    graph->string_arena.chunks = NULL;
+    graph->string_arena.reserved = 0;
+    graph->string_arena.used = 0;
+    graph->strings = NULL;
 
     return (graph);
 }
@@ -23,7 +23,7 @@ void free_edges(edge_t *edges)
  */
 void graph_delete(graph_t *graph)
 {
-    vertex_t *vertex, *tmp;
+    vertex_t *vertex;
 
     if (!graph)
         return;
@@ -31,20 +31,16 @@ void graph_delete(graph_t *graph)
     vertex = graph->vertices;
     while (vertex)
     {
-        tmp = vertex;
-        vertex = vertex->next;
-        
-        /* Free the content string */
-        if (tmp->content)
-            free(tmp->content);
-        
         /* Free all edges */
-        free_edges(tmp->edges);
-        
-        /* Free the vertex itself */
-        free(tmp);
+        free_edges(vertex->edges);
+        vertex = vertex->next;
     }
 
+    /* Free the vertices and the contents too long to be inlined */
+    string_table_delete(graph->strings);
+    arena_clear(&graph->vertex_arena);
+    arena_clear(&graph->string_arena);
+
     /* Free the graph structure */
     free(graph);
 }
@@ -0,0 +1,149 @@
+#include "graphs.h"
+#include <stdlib.h>
+
+#define DELTA_LOG_MIN_ENTRIES 64
+
+/**
+ * delta_log_create - Allocates an empty delta log
+ * @nb_vertices: Number of vertices of the graph the log applies to
+ *
+ * Return: Pointer to the created log, or NULL on failure
+ */
+delta_log_t *delta_log_create(size_t nb_vertices)
+{
+	delta_log_t *log;
+	size_t i;
+
+	log = malloc(sizeof(*log));
+	if (!log)
+		return (NULL);
+	log->size = 0;
+	log->nb_adds = 0;
+	log->nb_removes = 0;
+	log->max_degree = 0;
+	log->capacity = DELTA_LOG_MIN_ENTRIES;
+	log->entries = malloc(sizeof(*log->entries) * log->capacity);
+	log->heads = malloc(sizeof(*log->heads) * (nb_vertices + 1));
+	log->net_adds = calloc(nb_vertices + 1, sizeof(*log->net_adds));
+	if (!log->entries || !log->heads || !log->net_adds)
+	{
+		delta_log_delete(log);
+		return (NULL);
+	}
+	for (i = 0; i < nb_vertices; i++)
+		log->heads[i] = DELTA_END;
+	return (log);
+}
+
+/**
+ * delta_log_delete - Deallocates a delta log
+ * @log: Pointer to the log to delete
+ */
+void delta_log_delete(delta_log_t *log)
+{
+	if (!log)
+		return;
+
+	free(log->entries);
+	free(log->heads);
+	free(log->net_adds);
+	free(log);
+}
+
+/**
+ * delta_log_find - Finds the change recorded for an edge
+ * @log: Pointer to the log
+ * @src: Index of the source vertex
+ * @dest: Index of the destination vertex
+ *
+ * Return: Pointer to the entry, or NULL if the edge is unchanged
+ */
+delta_entry_t *delta_log_find(const delta_log_t *log, size_t src,
+		size_t dest)
+{
+	size_t i;
+
+	for (i = log->heads[src]; i != DELTA_END; i = log->entries[i].next)
+		if (log->entries[i].dest == dest &&
+			log->entries[i].op != DELTA_NONE)
+			return (&log->entries[i]);
+	return (NULL);
+}
+
+/**
+ * delta_log_append - Records the change of an edge
+ * @log: Pointer to the log
+ * @src: Index of the source vertex
+ * @dest: Index of the destination vertex
+ * @op: Change made to the edge
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int delta_log_append(delta_log_t *log, size_t src, size_t dest,
+		delta_op_t op)
+{
+	delta_entry_t *entries;
+
+	if (log->size == log->capacity)
+	{
+		entries = realloc(log->entries,
+			sizeof(*entries) * log->capacity * 2);
+		if (!entries)
+			return (0);
+		log->entries = entries;
+		log->capacity *= 2;
+	}
+	log->entries[log->size].src = src;
+	log->entries[log->size].dest = dest;
+	log->entries[log->size].op = op;
+	log->entries[log->size].next = log->heads[src];
+	log->heads[src] = log->size++;
+	log->nb_adds += op == DELTA_ADD;
+	log->nb_removes += op == DELTA_REMOVE;
+	log->net_adds[src] += (op == DELTA_ADD) - (op == DELTA_REMOVE);
+	return (1);
+}
+
+/**
+ * delta_log_merge - Applies a delta log to a CSR snapshot
+ * @base: Pointer to the snapshot the log applies to
+ * @log: Pointer to the log
+ *
+ * Description: The edges kept from @base come first in each row, in the
+ * same order, followed by the added edges in the order they were added
+ *
+ * Return: Pointer to the new snapshot, or NULL on failure
+ */
+graph_csr_t *delta_log_merge(const graph_csr_t *base,
+		const delta_log_t *log)
+{
+	graph_csr_t *csr;
+	size_t i, v, *fill;
+
+	csr = graph_csr_alloc(base->nb_vertices,
+		base->nb_edges + log->nb_adds - log->nb_removes);
+	fill = malloc(sizeof(*fill) * (base->nb_vertices + 1));
+	if (!csr || !fill)
+	{
+		graph_csr_delete(csr);
+		free(fill);
+		return (NULL);
+	}
+	for (v = 0; v < base->nb_vertices; v++)
+	{
+		csr->offsets[v + 1] = csr->offsets[v] + base->offsets[v + 1] -
+			base->offsets[v] + log->net_adds[v];
+		fill[v] = csr->offsets[v];
+		if (csr->offsets[v + 1] - fill[v] > csr->max_degree)
+			csr->max_degree = csr->offsets[v + 1] - fill[v];
+		for (i = base->offsets[v]; i < base->offsets[v + 1]; i++)
+			if (!delta_log_find(log, v, base->targets[i]))
+				csr->targets[fill[v]++] = base->targets[i];
+	}
+	for (i = 0; i < log->size; i++)
+		if (log->entries[i].op == DELTA_ADD)
+			csr->targets[fill[log->entries[i].src]++] =
+				log->entries[i].dest;
+	free(fill);
+	return (csr);
+}
@@ -0,0 +1,129 @@
+#include "graphs.h"
+
+/**
+ * dyn_has_edge - Checks if an edge exists in a dynamic graph
+ * @dyn: Pointer to the dynamic graph, locked
+ * @src: Index of the source vertex
+ * @dest: Index of the destination vertex
+ *
+ * Return: 1 if the edge exists, 0 otherwise
+ */
+static int dyn_has_edge(const graph_dyn_t *dyn, size_t src, size_t dest)
+{
+	delta_entry_t *entry;
+	size_t i;
+
+	entry = delta_log_find(dyn->active, src, dest);
+	if (!entry && dyn->frozen)
+		entry = delta_log_find(dyn->frozen, src, dest);
+	if (entry)
+		return (entry->op == DELTA_ADD);
+	for (i = dyn->base->offsets[src]; i < dyn->base->offsets[src + 1]; i++)
+		if (dyn->base->targets[i] == dest)
+			return (1);
+	return (0);
+}
+
+/**
+ * dyn_set_edge - Adds or removes an edge of a dynamic graph
+ * @dyn: Pointer to the dynamic graph, locked for writing
+ * @src: Index of the source vertex
+ * @dest: Index of the destination vertex
+ * @op: DELTA_ADD or DELTA_REMOVE
+ *
+ * Description: Only actual changes are logged, and a change undoing the
+ * one logged for the same edge cancels it. An added edge raises the
+ * maximum degree of the active log if it brings @src past it.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int dyn_set_edge(graph_dyn_t *dyn, size_t src, size_t dest,
+		delta_op_t op)
+{
+	delta_log_t *active = dyn->active;
+	delta_entry_t *entry;
+	size_t degree;
+
+	if (dyn_has_edge(dyn, src, dest) == (op == DELTA_ADD))
+		return (1);
+	entry = delta_log_find(active, src, dest);
+	if (entry)
+	{
+		active->nb_adds -= entry->op == DELTA_ADD;
+		active->nb_removes -= entry->op == DELTA_REMOVE;
+		active->net_adds[src] += op == DELTA_ADD ? 1 : -1;
+		entry->op = DELTA_NONE;
+	}
+	else if (!delta_log_append(active, src, dest, op))
+		return (0);
+	degree = dyn->base->offsets[src + 1] - dyn->base->offsets[src] +
+		active->net_adds[src];
+	if (dyn->frozen)
+		degree += dyn->frozen->net_adds[src];
+	if (op == DELTA_ADD && degree > active->max_degree)
+		active->max_degree = degree;
+	return (1);
+}
+
+/**
+ * dyn_change - Applies the change of an edge to a dynamic graph
+ * @dyn: Pointer to the dynamic graph
+ * @src: Index of the source vertex
+ * @dest: Index of the destination vertex
+ * @type: Type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ * @op: DELTA_ADD or DELTA_REMOVE
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int dyn_change(graph_dyn_t *dyn, size_t src, size_t dest,
+		edge_type_t type, delta_op_t op)
+{
+	int ret, frozen;
+
+	if (!dyn || src >= dyn->nb_vertices || dest >= dyn->nb_vertices)
+		return (0);
+	pthread_rwlock_wrlock(&dyn->lock);
+	ret = dyn_set_edge(dyn, src, dest, op) &&
+		(type != BIDIRECTIONAL || dyn_set_edge(dyn, dest, src, op));
+	frozen = graph_dyn_freeze(dyn, 0);
+	pthread_rwlock_unlock(&dyn->lock);
+	if (frozen)
+	{
+		pthread_mutex_lock(&dyn->wakeup_lock);
+		dyn->pending = 1;
+		pthread_cond_signal(&dyn->wakeup);
+		pthread_mutex_unlock(&dyn->wakeup_lock);
+	}
+	return (ret);
+}
+
+/**
+ * graph_dyn_add_edge - Adds an edge between two vertices of a dynamic graph
+ * @dyn: Pointer to the dynamic graph
+ * @src: Index of the vertex to make the connection from
+ * @dest: Index of the vertex to connect to
+ * @type: Type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_dyn_add_edge(graph_dyn_t *dyn, size_t src, size_t dest,
+		edge_type_t type)
+{
+	return (dyn_change(dyn, src, dest, type, DELTA_ADD));
+}
+
+/**
+ * graph_dyn_remove_edge - Removes an edge between two vertices of a
+ * dynamic graph
+ * @dyn: Pointer to the dynamic graph
+ * @src: Index of the vertex the connection is made from
+ * @dest: Index of the vertex it connects to
+ * @type: Type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_dyn_remove_edge(graph_dyn_t *dyn, size_t src, size_t dest,
+		edge_type_t type)
+{
+	return (dyn_change(dyn, src, dest, type, DELTA_REMOVE));
+}
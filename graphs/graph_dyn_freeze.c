@@ -0,0 +1,27 @@
+#include "graphs.h"
+
+/**
+ * graph_dyn_freeze - Hands the active log of a dynamic graph over to the
+ * compaction thread
+ * @dyn: Pointer to the dynamic graph, locked for writing
+ * @force: If 0, the log is only handed over once it reaches the threshold
+ *
+ * Description: Nothing happens while the previous log is being merged.
+ * It is up to the caller to wake the compaction thread up.
+ *
+ * Return: 1 if the log was handed over, 0 otherwise
+ */
+int graph_dyn_freeze(graph_dyn_t *dyn, int force)
+{
+	delta_log_t *active;
+
+	if (dyn->frozen || !dyn->active->size ||
+		(!force && dyn->active->size < dyn->threshold))
+		return (0);
+	active = delta_log_create(dyn->nb_vertices);
+	if (!active)
+		return (0);
+	dyn->frozen = dyn->active;
+	dyn->active = active;
+	return (1);
+}
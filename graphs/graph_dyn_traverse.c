@@ -0,0 +1,146 @@
+#include "graphs.h"
+#include <stdlib.h>
+
+#define UNVISITED ((size_t)-1)
+/* Vertices expanded each time the graph is locked */
+#define DYN_BFS_BATCH 64
+
+/**
+ * struct dyn_bfs_s - State of a breadth-first traversal
+ *
+ * @queue: Vertices to visit, in order
+ * @tail: Number of vertices pushed to @queue
+ * @depth: Depth of each vertex, UNVISITED if not reached yet
+ */
+typedef struct dyn_bfs_s
+{
+	size_t *queue;
+	size_t tail;
+	size_t *depth;
+} dyn_bfs_t;
+
+/**
+ * bfs_push - Queues a vertex if it was not reached yet
+ * @bfs: Pointer to the traversal state
+ * @v: Index of the vertex
+ * @depth: Depth of the vertex
+ */
+static void bfs_push(dyn_bfs_t *bfs, size_t v, size_t depth)
+{
+	if (bfs->depth[v] != UNVISITED)
+		return;
+	bfs->depth[v] = depth;
+	bfs->queue[bfs->tail++] = v;
+}
+
+/**
+ * is_removed - Checks if a log removes an edge
+ * @log: Pointer to the log, can be NULL
+ * @src: Index of the source vertex
+ * @dest: Index of the destination vertex
+ *
+ * Return: 1 if the edge is removed, 0 otherwise
+ */
+static int is_removed(const delta_log_t *log, size_t src, size_t dest)
+{
+	delta_entry_t *entry;
+
+	if (!log)
+		return (0);
+	entry = delta_log_find(log, src, dest);
+	return (entry && entry->op == DELTA_REMOVE);
+}
+
+/**
+ * dyn_expand - Queues the neighbors of a vertex of a dynamic graph
+ * @dyn: Pointer to the dynamic graph, locked for reading
+ * @v: Index of the vertex
+ * @bfs: Pointer to the traversal state
+ *
+ * Description: The snapshot's edges are read first, minus the ones the
+ * frozen or active log removes, then the edges the frozen log adds, minus
+ * the ones the active log removes, and last the edges the active log adds.
+ * Vertices neither log changes only read the snapshot.
+ */
+static void dyn_expand(const graph_dyn_t *dyn, size_t v, dyn_bfs_t *bfs)
+{
+	const graph_csr_t *base = dyn->base;
+	size_t i, depth = bfs->depth[v] + 1;
+	delta_entry_t *entry;
+
+	if ((!dyn->frozen || dyn->frozen->heads[v] == DELTA_END) &&
+		dyn->active->heads[v] == DELTA_END)
+	{
+		for (i = base->offsets[v]; i < base->offsets[v + 1]; i++)
+			bfs_push(bfs, base->targets[i], depth);
+		return;
+	}
+	for (i = base->offsets[v]; i < base->offsets[v + 1]; i++)
+		if (!is_removed(dyn->frozen, v, base->targets[i]) &&
+			!is_removed(dyn->active, v, base->targets[i]))
+			bfs_push(bfs, base->targets[i], depth);
+	for (i = dyn->frozen ? dyn->frozen->heads[v] : DELTA_END;
+		i != DELTA_END; i = entry->next)
+	{
+		entry = &dyn->frozen->entries[i];
+		if (entry->op == DELTA_ADD &&
+			!is_removed(dyn->active, v, entry->dest))
+			bfs_push(bfs, entry->dest, depth);
+	}
+	for (i = dyn->active->heads[v]; i != DELTA_END; i = entry->next)
+	{
+		entry = &dyn->active->entries[i];
+		if (entry->op == DELTA_ADD)
+			bfs_push(bfs, entry->dest, depth);
+	}
+}
+
+/**
+ * graph_dyn_breadth_first - Traverses a dynamic graph using breadth-first
+ * algorithm
+ * @dyn: Pointer to the dynamic graph to traverse
+ * @start: Index of the vertex to start from
+ * @action: Function to call for each visited vertex, can be NULL
+ *
+ * Description: The graph is locked for reading DYN_BFS_BATCH vertices at a
+ * time, and @action is called with it unlocked, so changes aren't held up
+ * by a whole traversal and @action may change the graph. Each vertex's
+ * edges are read as they are when it is expanded, so the traversal may
+ * see changes made while it runs.
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t graph_dyn_breadth_first(graph_dyn_t *dyn, size_t start,
+		void (*action)(size_t index, size_t depth))
+{
+	dyn_bfs_t bfs;
+	size_t head = 0, visited = 0, end, v, max_depth = 0;
+
+	if (!dyn || start >= dyn->nb_vertices)
+		return (0);
+	bfs.queue = malloc(sizeof(size_t) * dyn->nb_vertices * 2);
+	if (!bfs.queue)
+		return (0);
+	bfs.depth = bfs.queue + dyn->nb_vertices;
+	for (v = 0; v < dyn->nb_vertices; v++)
+		bfs.depth[v] = UNVISITED;
+	bfs.tail = 0;
+	bfs_push(&bfs, start, 0);
+	while (head < bfs.tail)
+	{
+		pthread_rwlock_rdlock(&dyn->lock);
+		for (end = head + DYN_BFS_BATCH; head < bfs.tail && head < end;
+			head++)
+			dyn_expand(dyn, bfs.queue[head], &bfs);
+		pthread_rwlock_unlock(&dyn->lock);
+		for (; visited < head; visited++)
+		{
+			v = bfs.queue[visited];
+			if (action)
+				action(v, bfs.depth[v]);
+			max_depth = bfs.depth[v];
+		}
+	}
+	free(bfs.queue);
+	return (max_depth);
+}
@@ -0,0 +1,67 @@
+#include "graphs.h"
+#include <stdlib.h>
+
+/**
+ * partition_stats_fill - Measures the quality of a graph partition whose
+ * part sizes are known
+ * @graph: Pointer to the partitioned graph
+ * @k: Number of parts
+ * @part: Part of each vertex, by vertex index
+ * @sizes: Number of vertices in each of the @k parts
+ * @stats: Receives the edge-cut and balance of the partition
+ */
+void partition_stats_fill(const graph_t *graph, size_t k, const size_t *part,
+		const size_t *sizes, partition_stats_t *stats)
+{
+	size_t i;
+	vertex_t *v;
+	edge_t *e;
+
+	stats->nb_parts = k;
+	stats->edge_cut = 0;
+	stats->nb_edges = 0;
+	stats->rounds = 0;
+	stats->moves = 0;
+	for (v = graph->vertices; v; v = v->next)
+		for (e = v->edges; e; e = e->next, stats->nb_edges++)
+			if (part[v->index] != part[e->dest->index])
+				stats->edge_cut++;
+	stats->min_part = sizes[0];
+	stats->max_part = sizes[0];
+	for (i = 1; i < k; i++)
+	{
+		if (sizes[i] < stats->min_part)
+			stats->min_part = sizes[i];
+		if (sizes[i] > stats->max_part)
+			stats->max_part = sizes[i];
+	}
+	stats->imbalance = graph->nb_vertices ?
+		(double)stats->max_part * k / graph->nb_vertices : 0;
+}
+
+/**
+ * graph_partition_stats - Measures the quality of a graph partition
+ * @graph: Pointer to the partitioned graph
+ * @k: Number of parts
+ * @part: Part of each vertex, by vertex index
+ * @stats: Receives the edge-cut and balance of the partition
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_partition_stats(const graph_t *graph, size_t k,
+		const size_t *part, partition_stats_t *stats)
+{
+	size_t *sizes;
+	vertex_t *v;
+
+	if (!graph || !k || !part || !stats)
+		return (0);
+	sizes = calloc(k, sizeof(*sizes));
+	if (!sizes)
+		return (0);
+	for (v = graph->vertices; v; v = v->next)
+		sizes[part[v->index]]++;
+	partition_stats_fill(graph, k, part, sizes, stats);
+	free(sizes);
+	return (1);
+}
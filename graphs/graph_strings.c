@@ -0,0 +1,128 @@
+#include "graphs.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define STRING_TABLE_MIN_SLOTS 64
+
+/**
+ * graph_string_hash - Computes the hash of a vertex content
+ * @str: String to hash
+ *
+ * Description: 64-bit FNV-1a, cheap on the short strings used as vertex
+ * names
+ *
+ * Return: The hash of @str
+ */
+unsigned long graph_string_hash(const char *str)
+{
+	unsigned long hash = 14695981039346656037UL;
+
+	while (*str)
+	{
+		hash ^= (unsigned char)*str++;
+		hash *= 1099511628211UL;
+	}
+	return (hash);
+}
+
+/**
+ * string_table_create - Allocates an empty string table
+ *
+ * Return: Pointer to the created table, or NULL on failure
+ */
+string_table_t *string_table_create(void)
+{
+	string_table_t *table;
+
+	table = malloc(sizeof(*table));
+	if (!table)
+		return (NULL);
+	table->slots = calloc(STRING_TABLE_MIN_SLOTS, sizeof(*table->slots));
+	if (!table->slots)
+	{
+		free(table);
+		return (NULL);
+	}
+	table->nb_strings = 0;
+	table->capacity = STRING_TABLE_MIN_SLOTS;
+	return (table);
+}
+
+/**
+ * string_table_grow - Doubles the number of slots of a string table
+ * @table: Pointer to the table
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int string_table_grow(string_table_t *table)
+{
+	string_slot_t *slots;
+	size_t i, j, mask = table->capacity * 2 - 1;
+
+	slots = calloc(table->capacity * 2, sizeof(*slots));
+	if (!slots)
+		return (0);
+	for (i = 0; i < table->capacity; i++)
+	{
+		if (!table->slots[i].str)
+			continue;
+		for (j = table->slots[i].hash & mask; slots[j].str;)
+			j = (j + 1) & mask;
+		slots[j] = table->slots[i];
+	}
+	free(table->slots);
+	table->slots = slots;
+	table->capacity *= 2;
+	return (1);
+}
+
+/**
+ * string_table_intern - Gets the interned copy of a string
+ * @table: Pointer to the table
+ * @arena: Arena to copy the string to, if it is not in the table yet
+ * @str: String to intern
+ * @hash: Hash of @str (see graph_string_hash)
+ *
+ * Return: Pointer to the interned string, or NULL on failure
+ */
+char *string_table_intern(string_table_t *table, arena_t *arena,
+		const char *str, unsigned long hash)
+{
+	size_t i, len;
+	char *copy;
+
+	if (!table || !arena || !str)
+		return (NULL);
+	if (table->nb_strings * 4 >= table->capacity * 3 &&
+		!string_table_grow(table))
+		return (NULL);
+	for (i = hash & (table->capacity - 1); table->slots[i].str;
+		i = (i + 1) & (table->capacity - 1))
+		if (table->slots[i].hash == hash &&
+			!strcmp(table->slots[i].str, str))
+			return (table->slots[i].str);
+	len = strlen(str) + 1;
+	copy = arena_alloc(arena, len, 1);
+	if (!copy)
+		return (NULL);
+	table->slots[i].hash = hash;
+	table->slots[i].str = memcpy(copy, str, len);
+	table->nb_strings++;
+	return (copy);
+}
+
+/**
+ * string_table_delete - Deallocates a string table
+ * @table: Pointer to the table to delete
+ *
+ * Description: The strings themselves belong to the arena they were
+ * interned in
+ */
+void string_table_delete(string_table_t *table)
+{
+	if (!table)
+		return;
+
+	free(table->slots);
+	free(table);
+}
@@ -0,0 +1,30 @@
+#include "graphs.h"
+#include <stdlib.h>
+
+/**
+ * graph_vertex_array - Builds a lookup table of the vertices of a graph
+ * @graph: Pointer to the graph
+ *
+ * Description: Vertices are stored in a linked list, but their indexes
+ * are contiguous, so the table gives O(1) access to a vertex by index.
+ * It must be freed by the caller.
+ *
+ * Return: Array of nb_vertices pointers, or NULL on failure
+ */
+vertex_t **graph_vertex_array(const graph_t *graph)
+{
+	vertex_t **vertices;
+	vertex_t *vertex;
+
+	if (!graph || !graph->nb_vertices)
+		return (NULL);
+
+	vertices = malloc(sizeof(*vertices) * graph->nb_vertices);
+	if (!vertices)
+		return (NULL);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		vertices[vertex->index] = vertex;
+
+	return (vertices);
+}
@@ -0,0 +1,102 @@
+#include "graphs.h"
+#include <string.h>
+
+/**
+ * graph_vertex_new - Allocates and initializes a vertex of a graph
+ * @graph: Pointer to the graph the vertex will belong to
+ * @str: String to store in the vertex
+ * @hash: Hash of @str (see graph_string_hash)
+ *
+ * Description: The vertex is allocated in the graph's vertex arena.
+ * Short strings are copied inside the vertex itself, longer ones are
+ * interned in the graph's string table, so neither costs an allocation
+ * of its own.
+ * The vertex is given the next index, but it is up to the caller to link
+ * it in the list of vertices and to count it in nb_vertices.
+ *
+ * Return: Pointer to the created vertex, or NULL on failure
+ */
+vertex_t *graph_vertex_new(graph_t *graph, const char *str,
+		unsigned long hash)
+{
+	vertex_t *vertex;
+	char *content = NULL;
+	size_t len;
+
+	if (!graph || !str)
+		return (NULL);
+	len = strlen(str);
+	if (len >= VERTEX_INLINE_SIZE)
+	{
+		if (!graph->strings)
+			graph->strings = string_table_create();
+		content = string_table_intern(graph->strings,
+			&graph->string_arena, str, hash);
+		if (!content)
+			return (NULL);
+	}
+	vertex = arena_alloc(&graph->vertex_arena, sizeof(*vertex),
+		sizeof(void *));
+	if (!vertex)
+		return (NULL);
+	if (!content)
+		content = memcpy(vertex->inline_content, str, len + 1);
+	vertex->index = graph->nb_vertices;
+	vertex->content = content;
+	vertex->hash = hash;
+	vertex->nb_edges = 0;
+	vertex->edges = NULL;
+	vertex->next = NULL;
+	return (vertex);
+}
+
+/**
+ * graph_vertex_find - Finds a vertex in a graph by content
+ * @graph: Pointer to the graph
+ * @str: String to search for
+ * @hash: Hash of @str (see graph_string_hash)
+ *
+ * Description: Instead of following the list of vertices, the chunks of
+ * the vertex arena are scanned as arrays, so the loads don't depend on
+ * each other. Contents are only compared when the hashes match.
+ *
+ * Return: Pointer to the vertex if found, NULL otherwise
+ */
+vertex_t *graph_vertex_find(const graph_t *graph, const char *str,
+		unsigned long hash)
+{
+	arena_chunk_t *chunk;
+	vertex_t *vertex, *end;
+
+	if (!graph || !str)
+		return (NULL);
+	for (chunk = graph->vertex_arena.chunks; chunk; chunk = chunk->next)
+	{
+		vertex = (vertex_t *)(chunk + 1);
+		end = vertex + chunk->used / sizeof(*vertex);
+		for (; vertex < end; vertex++)
+			if (vertex->hash == hash &&
+				strcmp(vertex->content, str) == 0)
+				return (vertex);
+	}
+	return (NULL);
+}
+
+/**
+ * graph_vertex_last - Gets the last vertex of the list of vertices
+ * @graph: Pointer to the graph
+ *
+ * Description: Vertices are appended in the order they are allocated, so
+ * the last one is at the end of the current chunk of the vertex arena
+ *
+ * Return: Pointer to the last vertex, or NULL if the graph is empty
+ */
+vertex_t *graph_vertex_last(const graph_t *graph)
+{
+	arena_chunk_t *chunk;
+
+	if (!graph || !graph->vertex_arena.chunks)
+		return (NULL);
+	chunk = graph->vertex_arena.chunks;
+	return ((vertex_t *)(chunk + 1) + chunk->used / sizeof(vertex_t) - 1);
+}
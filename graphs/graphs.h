@@ -2,6 +2,7 @@
 #define GRAPHS_H
 
 #include <stddef.h>
+#include <pthread.h>
 
 /**
  * enum edge_type_e - Enumerates the different types of
@@ -33,39 +34,363 @@ typedef struct edge_s
 } edge_t;
 
 
+/* Contents shorter than this (terminating null byte included) are inlined */
+#define VERTEX_INLINE_SIZE 16
+
 /**
  * struct vertex_s - Node in the linked list of vertices in the adjacency list
  *
  * @index: Index of the vertex in the adjacency list.
  * @content: Custom data stored in the vertex (here, a string)
+ *   It points either to @inline_content, or to the graph's string table
+ *   when the string doesn't fit inline. It must not be freed.
+ * Vertices are allocated in the graph's vertex arena, and must not be
+ * freed either (see graph_vertex_new)
+ * @hash: Hash of @content (see graph_string_hash), compared before
+ *   the strings themselves when looking up a vertex
  * @nb_edges: Number of conenctions with other vertices in the graph
  * @edges: Pointer to the head node of the linked list of edges
  * @next: Pointer to the next vertex in the adjacency linked list
  *   This pointer points to another vertex in the graph, but it
  *   doesn't stand for an edge between the two vertices
+ * @inline_content: Storage for short contents
  */
 struct vertex_s
 {
     size_t      index;
     char        *content;
+    unsigned long   hash;
     size_t      nb_edges;
     edge_t      *edges;
     struct vertex_s *next;
+    char        inline_content[VERTEX_INLINE_SIZE];
 };
 
+/**
+ * struct arena_chunk_s - Block of memory of an arena
+ * The memory handed out by the arena follows the header
+ *
+ * @next: Pointer to the previously filled chunk
+ * @size: Number of bytes available in the chunk
+ * @used: Number of bytes already handed out
+ */
+typedef struct arena_chunk_s
+{
+    struct arena_chunk_s    *next;
+    size_t      size;
+    size_t      used;
+} arena_chunk_t;
+
+/**
+ * struct arena_s - Bump allocator releasing all its memory at once
+ *
+ * @chunks: Pointer to the chunk currently being filled
+ * @reserved: Number of bytes allocated for chunks, headers included
+ * @used: Number of bytes handed out
+ */
+typedef struct arena_s
+{
+    arena_chunk_t   *chunks;
+    size_t      reserved;
+    size_t      used;
+} arena_t;
+
+/**
+ * struct string_slot_s - Slot of the open addressing table of a string table
+ *
+ * @hash: Hash of the string
+ * @str: Interned string, NULL if the slot is free
+ */
+typedef struct string_slot_s
+{
+    unsigned long   hash;
+    char        *str;
+} string_slot_t;
+
+/**
+ * struct string_table_s - Set of interned strings
+ * Each distinct string is stored once, in an arena, so that interning
+ * doesn't cost an allocation per string
+ *
+ * @nb_strings: Number of strings in the table
+ * @capacity: Number of slots in @slots (a power of 2)
+ * @slots: Open addressing hash table of the strings
+ */
+typedef struct string_table_s
+{
+    size_t      nb_strings;
+    size_t      capacity;
+    string_slot_t   *slots;
+} string_table_t;
+
 /**
  * struct graph_s - Representation of a graph
  * We use an adjacency linked list to represent our graph
  *
  * @nb_vertices: Number of vertices in our graph
  * @vertices: Pointer to the head node of our adjacency linked list
+ * @vertex_arena: Storage of the vertices. It holds nothing else, so its
+ *   chunks are arrays of vertices that can be scanned sequentially
+ * @string_arena: Storage of the contents too long to be inlined in their
+ *   vertex
+ * @strings: Table of the contents stored in @string_arena, created with
+ *   the first of them
  */
 typedef struct graph_s
 {
     size_t      nb_vertices;
     vertex_t    *vertices;
+    arena_t     vertex_arena;
+    arena_t     string_arena;
+    string_table_t  *strings;
 } graph_t;
 
+#define PARTITION_MAX_ROUNDS 16
+
+/**
+ * struct partition_options_s - Settings trading partitioning time for cut
+ * quality
+ *
+ * @nb_threads: Number of threads refinement rounds are spread on, 0 for 1
+ * @max_rounds: Most refinement rounds, 0 for PARTITION_MAX_ROUNDS
+ * @min_moves: Refinement stops after a round moving this many vertices
+ *   or fewer
+ */
+typedef struct partition_options_s
+{
+    size_t      nb_threads;
+    size_t      max_rounds;
+    size_t      min_moves;
+} partition_options_t;
+
+/**
+ * struct partition_stats_s - Quality report of a graph partition
+ *
+ * @nb_parts: Number of parts the graph was split into
+ * @edge_cut: Number of edges whose endpoints lie in different parts
+ * @nb_edges: Total number of edges in the graph
+ * @min_part: Number of vertices in the smallest part
+ * @max_part: Number of vertices in the largest part
+ * @imbalance: Ratio between the largest part and the ideal part size
+ * @rounds: Number of refinement rounds performed
+ * @moves: Number of vertices moved during refinement
+ */
+typedef struct partition_stats_s
+{
+    size_t      nb_parts;
+    size_t      edge_cut;
+    size_t      nb_edges;
+    size_t      min_part;
+    size_t      max_part;
+    double      imbalance;
+    size_t      rounds;
+    size_t      moves;
+} partition_stats_t;
+
+/**
+ * struct ghost_vertex_s - Entry of a shard's ghost vertex table
+ * A ghost is a vertex owned by another part, but targeted by an edge
+ * leaving one of the shard's own vertices
+ *
+ * @global_index: Index of the vertex in the partitioned graph
+ * @owner: Part owning the vertex
+ */
+typedef struct ghost_vertex_s
+{
+    size_t      global_index;
+    size_t      owner;
+} ghost_vertex_t;
+
+/**
+ * struct graph_shard_s - Subgraph holding the vertices of one part
+ *
+ * @part: Part this shard was extracted for
+ * @graph: Local graph. Owned vertices come first (local indices
+ *   0 to @nb_owned - 1), followed by the ghost vertices
+ * @nb_owned: Number of vertices owned by the shard
+ * @global_index: Global index of each owned vertex, by local index
+ * @nb_ghosts: Number of ghost vertices
+ * @ghosts: Ghost table, the ghost at local index @nb_owned + i
+ *   is described by @ghosts[i]
+ * @edge_cut: Number of edges leading from an owned vertex to a ghost
+ * @nb_edges: Number of edges leaving the owned vertices
+ */
+typedef struct graph_shard_s
+{
+    size_t          part;
+    graph_t         *graph;
+    size_t          nb_owned;
+    size_t          *global_index;
+    size_t          nb_ghosts;
+    ghost_vertex_t  *ghosts;
+    size_t          edge_cut;
+    size_t          nb_edges;
+} graph_shard_t;
+
+/**
+ * struct graph_csr_s - Read-only snapshot of a graph in compressed sparse
+ * row form
+ * The edges leaving the vertex of index i are the entries @offsets[i] to
+ * @offsets[i + 1] - 1 of @targets, in the order of its edges list
+ *
+ * @nb_vertices: Number of vertices
+ * @nb_edges: Number of edges
+ * @max_degree: Largest number of edges leaving a vertex
+ * @offsets: Table of @nb_vertices + 1 offsets in @targets
+ * @targets: Index of the destination of each edge
+ */
+typedef struct graph_csr_s
+{
+    size_t      nb_vertices;
+    size_t      nb_edges;
+    size_t      max_degree;
+    size_t      *offsets;
+    size_t      *targets;
+} graph_csr_t;
+
+/**
+ * enum delta_op_e - Change recorded in a delta log
+ *
+ * @DELTA_NONE: Cancelled entry
+ * @DELTA_ADD: The edge is added
+ * @DELTA_REMOVE: The edge is removed
+ */
+typedef enum delta_op_e
+{
+    DELTA_NONE = 0,
+    DELTA_ADD,
+    DELTA_REMOVE
+} delta_op_t;
+
+/**
+ * struct delta_entry_s - Change of one edge in a delta log
+ *
+ * @src: Index of the source vertex
+ * @dest: Index of the destination vertex
+ * @op: Change made to the edge
+ * @next: Position of the previous entry with the same source in the log,
+ *   or DELTA_END
+ */
+typedef struct delta_entry_s
+{
+    size_t      src;
+    size_t      dest;
+    delta_op_t  op;
+    size_t      next;
+} delta_entry_t;
+
+#define DELTA_END ((size_t)-1)
+
+/**
+ * struct delta_log_s - Edges added to or removed from a graph
+ * A log records at most one change per edge, relative to the graph it
+ * applies to
+ *
+ * @size: Number of entries
+ * @capacity: Number of entries allocated
+ * @entries: Entries, in the order they were made
+ * @heads: Position of the latest entry of each source vertex, or DELTA_END
+ * @nb_adds: Number of entries adding an edge
+ * @nb_removes: Number of entries removing an edge
+ * @net_adds: Edges added minus edges removed, for each source vertex
+ * @max_degree: Largest degree an added edge brought a vertex to, 0 if none
+ */
+typedef struct delta_log_s
+{
+    size_t      size;
+    size_t      capacity;
+    delta_entry_t   *entries;
+    size_t      *heads;
+    size_t      nb_adds;
+    size_t      nb_removes;
+    long        *net_adds;
+    size_t      max_degree;
+} delta_log_t;
+
+/**
+ * struct graph_dyn_s - Graph accepting edge changes while staying close
+ * to CSR traversal speed
+ * Changes are appended to the @active log. When it reaches @threshold
+ * entries, it becomes the @frozen log, and a background thread merges it
+ * into a new @base while a new @active log takes the next changes.
+ * Traversals see @base, then @frozen, then @active.
+ *
+ * @nb_vertices: Number of vertices
+ * @base: Read-optimized snapshot
+ * @frozen: Log being merged into the next snapshot, or NULL
+ * @active: Log receiving the changes
+ * @threshold: Number of entries of @active triggering a compaction
+ * @nb_compactions: Number of compactions completed
+ * @lock: Held for reading by traversals, for writing by changes. It
+ *   protects @base, @frozen, @active and @nb_compactions
+ * @wakeup_lock: Protects @pending, @stop and @nb_attempts
+ * @wakeup: Signaled when @pending or @stop is set
+ * @done: Signaled when a compaction attempt completes
+ * @pending: Set when @frozen is ready to be merged
+ * @stop: Set when the graph is being deleted
+ * @nb_attempts: Number of compactions attempted
+ * @worker: Thread running the compactions
+ */
+typedef struct graph_dyn_s
+{
+    size_t          nb_vertices;
+    graph_csr_t     *base;
+    delta_log_t     *frozen;
+    delta_log_t     *active;
+    size_t          threshold;
+    size_t          nb_compactions;
+    pthread_rwlock_t    lock;
+    pthread_mutex_t     wakeup_lock;
+    pthread_cond_t      wakeup;
+    pthread_cond_t      done;
+    int             pending;
+    int             stop;
+    size_t          nb_attempts;
+    pthread_t       worker;
+} graph_dyn_t;
+
+/* Default number of changes triggering a compaction */
+#define GRAPH_DYN_THRESHOLD 4096
+
+/**
+ * struct graph_memory_stats_s - Memory held by a graph
+ *
+ * @vertex_bytes: Bytes used by the vertices, inline contents included
+ * @edge_bytes: Bytes used by the edges
+ * @content_bytes: Bytes used by the contents stored outside the vertices
+ * @index_bytes: Bytes used by lookup structures (string table, CSR
+ *   offsets, delta log heads and counts) and by the structures heading them
+ * @overhead_bytes: Bytes lost to the allocator, estimated per malloc, and
+ *   to arena chunk headers
+ * @unused_bytes: Bytes reserved by arenas and growable tables for later
+ *   use, such as delta log entries past the last one
+ * @used_bytes: Bytes used in arenas and growable tables
+ * @reserved_bytes: Bytes reserved by arenas and growable tables, headers
+ *   and unused room included
+ * @total_bytes: Sum of all the above but @used_bytes and @reserved_bytes,
+ *   which overlap with them
+ * @nb_vertices: Number of vertices
+ * @nb_edges: Number of edges
+ * @avg_degree: Average number of edges leaving a vertex
+ * @max_degree: Largest number of edges leaving a vertex
+ */
+typedef struct graph_memory_stats_s
+{
+    size_t      vertex_bytes;
+    size_t      edge_bytes;
+    size_t      content_bytes;
+    size_t      index_bytes;
+    size_t      overhead_bytes;
+    size_t      unused_bytes;
+    size_t      used_bytes;
+    size_t      reserved_bytes;
+    size_t      total_bytes;
+    size_t      nb_vertices;
+    size_t      nb_edges;
+    double      avg_degree;
+    size_t      max_degree;
+} graph_memory_stats_t;
+
 /* Function prototypes */
 graph_t *graph_create(void);
 vertex_t *graph_add_vertex(graph_t *graph, const char *str);
@@ -73,5 +398,58 @@ size_t depth_first_traverse(const graph_t *graph, void (*action)(const vertex_t
 void graph_display(const graph_t *graph);
 void graph_delete(graph_t *graph);
 int graph_add_edge(graph_t *graph, const char *src, const char *dest, edge_type_t type);
+vertex_t **graph_vertex_array(const graph_t *graph);
+vertex_t *find_vertex(const graph_t *graph, const char *content);
+unsigned long graph_string_hash(const char *str);
+vertex_t *graph_vertex_new(graph_t *graph, const char *str,
+        unsigned long hash);
+vertex_t *graph_vertex_find(const graph_t *graph, const char *str,
+        unsigned long hash);
+vertex_t *graph_vertex_last(const graph_t *graph);
+void *arena_alloc(arena_t *arena, size_t size, size_t align);
+void arena_clear(arena_t *arena);
+string_table_t *string_table_create(void);
+char *string_table_intern(string_table_t *table, arena_t *arena,
+        const char *str, unsigned long hash);
+void string_table_delete(string_table_t *table);
+int graph_partition(const graph_t *graph, size_t k,
+        const partition_options_t *options, size_t *out_part,
+        partition_stats_t *stats);
+int graph_partition_stats(const graph_t *graph, size_t k,
+        const size_t *part, partition_stats_t *stats);
+void partition_stats_fill(const graph_t *graph, size_t k, const size_t *part,
+        const size_t *sizes, partition_stats_t *stats);
+graph_shard_t *graph_extract_shard(const graph_t *graph, const size_t *part,
+        size_t part_id);
+void graph_shard_delete(graph_shard_t *shard);
+graph_csr_t *graph_csr_alloc(size_t nb_vertices, size_t nb_edges);
+graph_csr_t *graph_csr_create(const graph_t *graph);
+void graph_csr_delete(graph_csr_t *csr);
+size_t graph_csr_breadth_first(const graph_csr_t *csr, size_t start,
+        void (*action)(size_t index, size_t depth));
+graph_dyn_t *graph_dyn_create(const graph_t *graph, size_t threshold);
+void graph_dyn_delete(graph_dyn_t *dyn);
+int graph_dyn_add_edge(graph_dyn_t *dyn, size_t src, size_t dest,
+        edge_type_t type);
+int graph_dyn_remove_edge(graph_dyn_t *dyn, size_t src, size_t dest,
+        edge_type_t type);
+int graph_dyn_compact(graph_dyn_t *dyn);
+int graph_dyn_freeze(graph_dyn_t *dyn, int force);
+size_t graph_dyn_breadth_first(graph_dyn_t *dyn, size_t start,
+        void (*action)(size_t index, size_t depth));
+double *graph_betweenness(const graph_t *graph, size_t nthreads,
+        size_t sample_k);
+int graph_memory_stats(const graph_t *graph, graph_memory_stats_t *stats);
+int graph_csr_memory_stats(const graph_csr_t *csr,
+        graph_memory_stats_t *stats);
+int graph_dyn_memory_stats(graph_dyn_t *dyn, graph_memory_stats_t *stats);
+delta_log_t *delta_log_create(size_t nb_vertices);
+void delta_log_delete(delta_log_t *log);
+delta_entry_t *delta_log_find(const delta_log_t *log, size_t src,
+        size_t dest);
+int delta_log_append(delta_log_t *log, size_t src, size_t dest,
+        delta_op_t op);
+graph_csr_t *delta_log_merge(const graph_csr_t *base,
+        const delta_log_t *log);
 #endif /* GRAPHS_H */
 
@@ -0,0 +1,169 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "heap.h"
+#include "huffman.h"
+
+/**
+ * nested_delete - Deallocates a tree of nested nodes and their symbols
+ *
+ * @node: Root of the tree
+ */
+void nested_delete(binary_tree_node_t *node)
+{
+    if (!node)
+        return;
+    nested_delete(node->left);
+    nested_delete(node->right);
+    free(node->data);
+    free(node);
+}
+
+/**
+ * tree_cost - Computes the number of bits a Huffman tree codes its
+ * symbols with
+ *
+ * @node: Root of the tree
+ * @depth: Depth of @node
+ *
+ * Return: Sum of the frequency times the depth of each leaf
+ */
+size_t tree_cost(const binary_tree_node_t *node, size_t depth)
+{
+    if (!node->left)
+        return (((symbol_t *)node->data)->freq * depth);
+    return (tree_cost(node->left, depth + 1) +
+        tree_cost(node->right, depth + 1));
+}
+
+/**
+ * tree_lengths - Gets the code length of each symbol from a Huffman tree
+ *
+ * @root: Root of the tree built by huffman_tree
+ * @size: Number of symbols of the tree
+ * @lengths: Receives the code length of each symbol, 0 for the symbols
+ *   left out of the tree
+ */
+void tree_lengths(binary_tree_node_t *root, size_t size,
+    unsigned char *lengths)
+{
+    binary_tree_node_t *node;
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        lengths[i] = 0;
+        for (node = &root[size - 1 + i]; node->parent; node = node->parent)
+            lengths[i]++;
+    }
+}
+
+/**
+ * bench - Builds the Huffman code of random frequencies, some of them 0,
+ * through huffman_priority_queue, through huffman_tree and through the
+ * two-queue method
+ *
+ * @size: Number of symbols
+ * @rounds: Number of times each construction is run
+ *
+ * Description: huffman_tree breaks ties like the two-queue method, so
+ * their lengths must be identical. The priority queue breaks them its
+ * own way, so only the number of bits its tree codes with must match.
+ * It gives a code to every symbol it is given, so it is only given the
+ * symbols of nonzero frequency, as its callers do.
+ *
+ * Return: 1 if the codes match, 0 otherwise
+ */
+int bench(size_t size, size_t rounds)
+{
+    binary_tree_node_t *root = NULL, *nested = NULL;
+    unsigned char *heap_lengths, *queue_lengths;
+    size_t *freq, *pq_freq, i, r, n = 0, pq_cost = 0, cost = 0;
+    huffman_symbol_t *data, *pq_data;
+    heap_t *pq;
+    clock_t start;
+    double pq_time, tree_time, queue_time;
+    int same;
+
+    freq = malloc(sizeof(*freq) * size * 2);
+    data = malloc(sizeof(*data) * size * 2);
+    heap_lengths = malloc(size);
+    queue_lengths = malloc(size);
+    if (!freq || !data || !heap_lengths || !queue_lengths)
+        return (0);
+    pq_freq = freq + size;
+    pq_data = data + size;
+    for (i = 0; i < size; i++)
+    {
+        /* Skewed frequencies, with many ties among the rare symbols */
+        freq[i] = rand() % 8 ? 1 + (size_t)rand() % 64 *
+            ((size_t)rand() % 64) * ((size_t)rand() % 64) : 0;
+        data[i] = i;
+        if (freq[i])
+        {
+            pq_data[n] = i;
+            pq_freq[n++] = freq[i];
+        }
+    }
+
+    start = clock();
+    for (r = 0; r < rounds; r++)
+    {
+        nested_delete(nested);
+        pq = huffman_priority_queue(pq_data, pq_freq, n);
+        while (pq && pq->size > 1 && huffman_extract_and_insert(pq))
+            ;
+        nested = pq && pq->size == 1 ? heap_extract(pq) : NULL;
+        heap_delete(pq, NULL);
+    }
+    pq_time = (double)(clock() - start) / CLOCKS_PER_SEC / rounds;
+    pq_cost = nested ? tree_cost(nested, 0) : 0;
+    nested_delete(nested);
+
+    start = clock();
+    for (r = 0; r < rounds; r++)
+    {
+        free(root);
+        root = huffman_tree(data, freq, size);
+    }
+    tree_time = (double)(clock() - start) / CLOCKS_PER_SEC / rounds;
+    if (root)
+        tree_lengths(root, size, heap_lengths);
+
+    start = clock();
+    for (r = 0; r < rounds; r++)
+        huffman_code_lengths(freq, size, 0, queue_lengths);
+    queue_time = (double)(clock() - start) / CLOCKS_PER_SEC / rounds;
+
+    for (i = 0; i < size; i++)
+        cost += freq[i] * queue_lengths[i];
+    same = root && !memcmp(heap_lengths, queue_lengths, size) &&
+        cost == pq_cost;
+    printf("%6lu symbols: priority queue %9.1f us, array heap %8.1f us, "
+        "two queues %7.1f us (%.1fx), %s\n", size, pq_time * 1e6,
+        tree_time * 1e6, queue_time * 1e6, pq_time / queue_time,
+        same ? "same codes" : "DIFFERENT codes");
+    free(root);
+    free(freq);
+    free(data);
+    free(heap_lengths);
+    free(queue_lengths);
+    return (same);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares the three ways to build a Huffman code, for a byte alphabet
+ * and for 64K symbols
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    srand(42);
+    if (!bench(256, 2000) || !bench(65536, 20))
+        return (EXIT_FAILURE);
+    return (EXIT_SUCCESS);
+}
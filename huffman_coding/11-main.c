@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "heap.h"
+#include "huffman.h"
+
+#define TEXT_SIZE (16 << 20)
+
+/**
+ * make_text - Generates English-like text, words being drawn with a
+ * Zipf-like distribution
+ *
+ * @text: Buffer to fill
+ * @size: Size of @text
+ */
+void make_text(unsigned char *text, size_t size)
+{
+    static const char * const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+        "as", "was", "with", "be", "by", "on", "not", "he", "this", "are",
+        "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her",
+        "has", "there", "been", "if", "more", "when", "will", "would",
+        "who", "so", "no", "Huffman", "coding", "table", "decoder,",
+        "symbols.", "frequency", "(bits)", "42", "1952;", "\"quoted\""
+    };
+    size_t nb_words = sizeof(words) / sizeof(words[0]), i = 0, len, w;
+
+    while (i < size)
+    {
+        w = (size_t)rand() % nb_words;
+        w = w * ((size_t)rand() % nb_words) / nb_words;
+        len = strlen(words[w]);
+        if (i + len + 1 > size)
+            break;
+        memcpy(text + i, words[w], len);
+        i += len;
+        text[i++] = rand() % 12 ? ' ' : '\n';
+    }
+    memset(text + i, ' ', size - i);
+}
+
+/**
+ * tree_decode - Decodes bytes by walking a Huffman tree bit by bit
+ *
+ * @root: Root of the tree
+ * @in: Encoded bits, most significant first
+ * @out: Buffer receiving the decoded bytes
+ * @out_size: Number of bytes to decode
+ */
+void tree_decode(const binary_tree_node_t *root, const unsigned char *in,
+    unsigned char *out, size_t out_size)
+{
+    const binary_tree_node_t *node;
+    size_t i, bit = 0;
+
+    for (i = 0; i < out_size; i++)
+    {
+        for (node = root; node->left; bit++)
+            node = in[bit >> 3] >> (7 - (bit & 7)) & 1 ? node->right :
+                node->left;
+        out[i] = (unsigned char)((symbol_t *)node->data)->data;
+    }
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares decoding speed between a walk in the Huffman tree and the
+ * table-driven canonical decoder, on the same text
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    unsigned char *text, *encoded, *decoded, lengths[HUFFMAN_NB_SYMBOLS];
+    huffman_code_t codes[HUFFMAN_NB_SYMBOLS];
+    size_t freq[HUFFMAN_NB_SYMBOLS], tree_freq[HUFFMAN_NB_SYMBOLS];
+    huffman_symbol_t data[HUFFMAN_NB_SYMBOLS];
+    size_t i, size, nb_symbols = 0;
+    binary_tree_node_t *root;
+    huffman_decoder_t *decoder;
+    clock_t start;
+    double seconds;
+
+    text = malloc(TEXT_SIZE);
+    encoded = malloc(TEXT_SIZE);
+    decoded = malloc(TEXT_SIZE);
+    if (!text || !encoded || !decoded)
+        return (EXIT_FAILURE);
+    srand(42);
+    make_text(text, TEXT_SIZE);
+    memset(freq, 0, sizeof(freq));
+    for (i = 0; i < TEXT_SIZE; i++)
+        freq[text[i]]++;
+    for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+    {
+        if (!freq[i])
+            continue;
+        data[nb_symbols] = i;
+        tree_freq[nb_symbols++] = freq[i];
+    }
+
+    root = huffman_tree(data, tree_freq, nb_symbols);
+    if (!root || !huffman_codes(root, codes, HUFFMAN_NB_SYMBOLS))
+        return (EXIT_FAILURE);
+    size = huffman_encode(codes, text, TEXT_SIZE, encoded, TEXT_SIZE);
+    start = clock();
+    tree_decode(root, encoded, decoded, TEXT_SIZE);
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("Tree walk:  %lu -> %lu bytes, %s, %.0f MB/s\n",
+        (size_t)TEXT_SIZE, size,
+        memcmp(text, decoded, TEXT_SIZE) ? "MISMATCH" : "ok",
+        TEXT_SIZE / seconds / 1e6);
+    free(root);
+
+    if (!huffman_code_lengths(freq, HUFFMAN_NB_SYMBOLS, 0, lengths) ||
+        !huffman_canonical_codes(lengths, HUFFMAN_NB_SYMBOLS, codes))
+        return (EXIT_FAILURE);
+    decoder = huffman_decoder_create(lengths, HUFFMAN_NB_SYMBOLS);
+    size = huffman_encode(codes, text, TEXT_SIZE, encoded, TEXT_SIZE);
+    if (!decoder || !size)
+        return (EXIT_FAILURE);
+    memset(decoded, 0, TEXT_SIZE);
+    start = clock();
+    if (!huffman_decode(decoder, encoded, size, decoded, TEXT_SIZE))
+        printf("Decoding failed\n");
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("Canonical:  %lu -> %lu bytes, %s, %.0f MB/s "
+        "(longest code %u bits)\n", (size_t)TEXT_SIZE, size,
+        memcmp(text, decoded, TEXT_SIZE) ? "MISMATCH" : "ok",
+        TEXT_SIZE / seconds / 1e6, decoder->max_length);
+
+    huffman_decoder_delete(decoder);
+    free(text);
+    free(encoded);
+    free(decoded);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "huffman.h"
+
+#define TEXT_SIZE (8 << 20)
+
+/**
+ * make_text - Generates English-like text, words being drawn with a
+ * Zipf-like distribution
+ *
+ * @text: Buffer to fill
+ * @size: Size of @text
+ */
+void make_text(unsigned char *text, size_t size)
+{
+    static const char * const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+        "as", "was", "with", "be", "by", "on", "not", "he", "this", "are",
+        "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her",
+        "has", "there", "been", "if", "more", "when", "will", "would",
+        "who", "so", "no", "Huffman", "coding", "table", "decoder,",
+        "symbols.", "frequency", "(bits)", "42", "1952;", "\"quoted\""
+    };
+    size_t nb_words = sizeof(words) / sizeof(words[0]), i = 0, len, w;
+
+    while (i < size)
+    {
+        w = (size_t)rand() % nb_words;
+        w = w * ((size_t)rand() % nb_words) / nb_words;
+        len = strlen(words[w]);
+        if (i + len + 1 > size)
+            break;
+        memcpy(text + i, words[w], len);
+        i += len;
+        text[i++] = rand() % 12 ? ' ' : '\n';
+    }
+    memset(text + i, ' ', size - i);
+}
+
+/**
+ * self_test - Compresses and decompresses generated text through files
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int self_test(void)
+{
+    FILE *raw, *packed, *unpacked;
+    unsigned char *text, *check;
+    long size;
+    clock_t start;
+    double compress_time, decompress_time;
+    int ok;
+
+    text = malloc(TEXT_SIZE);
+    check = malloc(TEXT_SIZE);
+    raw = tmpfile();
+    packed = tmpfile();
+    unpacked = tmpfile();
+    if (!text || !check || !raw || !packed || !unpacked)
+        return (EXIT_FAILURE);
+    srand(42);
+    make_text(text, TEXT_SIZE);
+    fwrite(text, 1, TEXT_SIZE, raw);
+    fflush(raw);
+    rewind(raw);
+
+    start = clock();
+    ok = huffman_compress_stream(fileno(raw), fileno(packed), 0);
+    compress_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    size = lseek(fileno(packed), 0, SEEK_CUR);
+    lseek(fileno(packed), 0, SEEK_SET);
+    start = clock();
+    ok = ok && huffman_decompress_stream(fileno(packed), fileno(unpacked));
+    decompress_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    lseek(fileno(unpacked), 0, SEEK_SET);
+    ok = ok && read(fileno(unpacked), check, TEXT_SIZE) == TEXT_SIZE &&
+        read(fileno(unpacked), check, 1) == 0 &&
+        !memcmp(text, check, TEXT_SIZE);
+
+    printf("%d -> %ld bytes (%.1f%%), round trip %s\n", TEXT_SIZE, size,
+        100.0 * size / TEXT_SIZE, ok ? "ok" : "FAILED");
+    printf("Compression: %.0f MB/s, decompression: %.0f MB/s\n",
+        TEXT_SIZE / compress_time / 1e6, TEXT_SIZE / decompress_time / 1e6);
+    fclose(raw);
+    fclose(packed);
+    fclose(unpacked);
+    free(text);
+    free(check);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * main - Entry point
+ *
+ * With "c" or "d" as argument, compresses or decompresses the standard
+ * input to the standard output, "c4" compressing to interleaved blocks
+ * and "ct" letting blocks use tANS, "cr" letting them reuse the code
+ * lengths of the block before, and "s" followed by a table id encoding
+ * them all with that static table. "ca" and "da" do the same with the
+ * adaptive coder, which writes out whatever it reads at once.
+ * Without argument, runs a round trip on generated text.
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int argc, char **argv)
+{
+    static const char * const modes[] = {"c", "c4", "ct", "cr"};
+    static const unsigned int flags[] = {
+        0, HUFFMAN_FLAG_INTERLEAVED, HUFFMAN_FLAG_TANS, HUFFMAN_FLAG_REUSE
+    };
+    size_t i;
+
+    if (argc < 2)
+        return (self_test());
+    for (i = 0; i < sizeof(modes) / sizeof(modes[0]); i++)
+        if (!strcmp(argv[1], modes[i]))
+            return (huffman_compress_stream(0, 1, flags[i]) ?
+                EXIT_SUCCESS : EXIT_FAILURE);
+    if (argv[1][0] == 's' && argv[1][1])
+        return (huffman_compress_stream(0, 1,
+            HUFFMAN_FLAG_TABLE(atoi(argv[1] + 1))) ? EXIT_SUCCESS :
+            EXIT_FAILURE);
+    if (!strcmp(argv[1], "ca"))
+        return (huffman_adaptive_compress_stream(0, 1) ? EXIT_SUCCESS :
+            EXIT_FAILURE);
+    if (!strcmp(argv[1], "da"))
+        return (huffman_adaptive_decompress_stream(0, 1) ? EXIT_SUCCESS :
+            EXIT_FAILURE);
+    if (!strcmp(argv[1], "d"))
+        return (huffman_decompress_stream(0, 1) ? EXIT_SUCCESS : EXIT_FAILURE);
+    fprintf(stderr, "Usage: %s [c|c4|ct|cr|s<table id>|d|ca|da] < input"
+        " > output\n", argv[0]);
+    return (EXIT_FAILURE);
+}
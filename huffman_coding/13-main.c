@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "huffman.h"
+
+#define TEXT_SIZE (32 << 20)
+
+/**
+ * make_text - Generates English-like text, words being drawn with a
+ * Zipf-like distribution
+ *
+ * @text: Buffer to fill
+ * @size: Size of @text
+ */
+void make_text(unsigned char *text, size_t size)
+{
+    static const char * const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+        "as", "was", "with", "be", "by", "on", "not", "he", "this", "are",
+        "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her",
+        "has", "there", "been", "if", "more", "when", "will", "would",
+        "who", "so", "no", "Huffman", "coding", "table", "decoder,",
+        "symbols.", "frequency", "(bits)", "42", "1952;", "\"quoted\""
+    };
+    size_t nb_words = sizeof(words) / sizeof(words[0]), i = 0, len, w;
+
+    while (i < size)
+    {
+        w = (size_t)rand() % nb_words;
+        w = w * ((size_t)rand() % nb_words) / nb_words;
+        len = strlen(words[w]);
+        if (i + len + 1 > size)
+            break;
+        memcpy(text + i, words[w], len);
+        i += len;
+        text[i++] = rand() % 12 ? ' ' : '\n';
+    }
+    memset(text + i, ' ', size - i);
+}
+
+/**
+ * now - Gets the wall clock time
+ *
+ * Return: Time in seconds
+ */
+double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * file_contents - Reads back the contents of a temporary file
+ *
+ * @file: The file
+ * @size: Receives the size of the file
+ *
+ * Return: The contents, to be freed by the caller
+ */
+unsigned char *file_contents(FILE *file, size_t *size)
+{
+    unsigned char *buf;
+
+    *size = lseek(fileno(file), 0, SEEK_END);
+    buf = malloc(*size + 1);
+    if (buf && pread(fileno(file), buf, *size, 0) != (ssize_t)*size)
+        *size = 0;
+    return (buf);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compresses and decompresses the same text with 1 to 16 threads, checks
+ * that the compressed streams are identical to the single-threaded one
+ * and that decompression leaves the input past the stream, and reports
+ * the throughput
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    FILE *raw, *packed, *unpacked;
+    unsigned char *text, *reference, *stream, *check;
+    size_t threads, reference_size, size, check_size;
+    double start, compress_time, decompress_time;
+    int ok, all_ok = 1;
+
+    text = malloc(TEXT_SIZE);
+    raw = tmpfile();
+    if (!text || !raw)
+        return (EXIT_FAILURE);
+    srand(42);
+    make_text(text, TEXT_SIZE);
+    fwrite(text, 1, TEXT_SIZE, raw);
+    fflush(raw);
+    packed = tmpfile();
+    lseek(fileno(raw), 0, SEEK_SET);
+    huffman_compress_stream(fileno(raw), fileno(packed), 0);
+    reference = file_contents(packed, &reference_size);
+    fclose(packed);
+
+    for (threads = 1; threads <= 16; threads *= 2)
+    {
+        packed = tmpfile();
+        unpacked = tmpfile();
+        lseek(fileno(raw), 0, SEEK_SET);
+        start = now();
+        ok = huffman_compress_stream_mt(fileno(raw), fileno(packed), threads,
+            0);
+        compress_time = now() - start;
+        stream = file_contents(packed, &size);
+        ok = ok && size == reference_size && !memcmp(stream, reference, size);
+        lseek(fileno(packed), 0, SEEK_SET);
+        start = now();
+        ok = ok && huffman_decompress_stream_mt(fileno(packed),
+            fileno(unpacked), threads);
+        decompress_time = now() - start;
+        ok = ok && lseek(fileno(packed), 0, SEEK_CUR) == (off_t)size;
+        check = file_contents(unpacked, &check_size);
+        ok = ok && check_size == TEXT_SIZE && !memcmp(check, text, TEXT_SIZE);
+        printf("%2lu threads: compression %5.0f MB/s, decompression %5.0f "
+            "MB/s, %s\n", threads, TEXT_SIZE / compress_time / 1e6,
+            TEXT_SIZE / decompress_time / 1e6, ok ? "ok" : "FAILED");
+        all_ok = all_ok && ok;
+        free(stream);
+        free(check);
+        fclose(packed);
+        fclose(unpacked);
+    }
+    free(reference);
+    free(text);
+    fclose(raw);
+    return (all_ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "huffman.h"
+
+#define BUF_SIZE (64 << 20)
+#define ROUNDS 4
+
+/**
+ * naive_histogram - Counts bytes one at a time in a single table
+ *
+ * @buf: Bytes to count
+ * @len: Number of bytes
+ * @freq: Table of frequencies to add the counts to
+ */
+void naive_histogram(const unsigned char *buf, size_t len, size_t *freq)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+        freq[buf[i]]++;
+}
+
+/**
+ * bench - Compares the naive count and huffman_histogram on a buffer
+ *
+ * @name: Name of the contents of the buffer
+ * @buf: Bytes to count
+ *
+ * Return: 1 if the counts are identical, 0 otherwise
+ */
+int bench(const char *name, const unsigned char *buf)
+{
+    size_t naive[HUFFMAN_NB_SYMBOLS], fast[HUFFMAN_NB_SYMBOLS], r;
+    clock_t start;
+    double naive_time, fast_time;
+    int same;
+
+    memset(naive, 0, sizeof(naive));
+    memset(fast, 0, sizeof(fast));
+    start = clock();
+    for (r = 0; r < ROUNDS; r++)
+        naive_histogram(buf, BUF_SIZE, naive);
+    naive_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (r = 0; r < ROUNDS; r++)
+        huffman_histogram(buf, BUF_SIZE, fast);
+    fast_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    same = !memcmp(naive, fast, sizeof(naive));
+    printf("%-12s naive %5.2f GB/s, huffman_histogram %5.2f GB/s, "
+        "counts %s\n", name, (double)BUF_SIZE * ROUNDS / naive_time / 1e9,
+        (double)BUF_SIZE * ROUNDS / fast_time / 1e9,
+        same ? "identical" : "DIFFERENT");
+    return (same);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    unsigned char *buf;
+    size_t i, blocks[3 * HUFFMAN_NB_SYMBOLS], total[HUFFMAN_NB_SYMBOLS];
+    int ok = 1;
+
+    buf = malloc(BUF_SIZE);
+    if (!buf)
+        return (EXIT_FAILURE);
+    srand(42);
+    for (i = 0; i < BUF_SIZE; i++)
+        buf[i] = rand();
+    ok = bench("random", buf) && ok;
+    for (i = 0; i < BUF_SIZE; i++)
+        buf[i] = "etaoin shrdlu"[rand() % 13 * (rand() % 13) / 13];
+    ok = bench("text-like", buf) && ok;
+    memset(buf, 'a', BUF_SIZE);
+    ok = bench("single byte", buf) && ok;
+
+    memset(total, 0, sizeof(total));
+    ok = huffman_histogram_blocks(buf, 1000, 400, blocks) == 3 && ok;
+    for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+        total[i] = blocks[i] + blocks[HUFFMAN_NB_SYMBOLS + i] +
+            blocks[2 * HUFFMAN_NB_SYMBOLS + i];
+    ok = blocks[2 * HUFFMAN_NB_SYMBOLS + 'a'] == 200 && total['a'] == 1000 &&
+        ok;
+    printf("Blocks: %s\n", ok ? "ok" : "FAILED");
+    free(buf);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
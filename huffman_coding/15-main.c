@@ -0,0 +1,177 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "huffman.h"
+
+#define DATA_SIZE (16 << 20)
+#define NB_FIBONACCI 40
+
+/**
+ * make_skewed - Generates bytes of geometric distribution, byte n coming
+ * half as often as byte n - 1
+ *
+ * @data: Buffer to fill
+ * @size: Size of @data
+ */
+void make_skewed(unsigned char *data, size_t size)
+{
+    unsigned long r;
+    size_t i;
+    unsigned char v;
+
+    for (i = 0; i < size; i++)
+    {
+        r = (unsigned long)rand() << 31 | (unsigned long)rand();
+        for (v = 0; r & 1 && v < 255; v++)
+            r >>= 1;
+        data[i] = v;
+    }
+}
+
+/**
+ * make_text - Generates English-like text, letters being drawn with
+ * roughly their frequency in English
+ *
+ * @data: Buffer to fill
+ * @size: Size of @data
+ */
+void make_text(unsigned char *data, size_t size)
+{
+    static const char letters[] =
+        "eeeeeeeeeeeetttttttttaaaaaaaaooooooooiiiiiiinnnnnnnsssssshhhhhh"
+        "rrrrrrddddlllluuucccmmmwwffggyyppbbvk          \n,.;:'\"()-0123"
+        "456789jxqzETAOINSHRDLU!?";
+    size_t i;
+
+    for (i = 0; i < size; i++)
+        data[i] = letters[(size_t)rand() % (sizeof(letters) - 1)];
+}
+
+/**
+ * report_limits - Prints the cost of limiting the code lengths of a
+ * distribution
+ *
+ * @name: Name of the distribution
+ * @freq: Frequencies of the symbols
+ * @size: Number of symbols
+ *
+ * Return: 1 if the limited codes are complete and within the limit,
+ * 0 otherwise
+ */
+int report_limits(const char *name, const size_t *freq, size_t size)
+{
+    static const unsigned int limits[] = {0, 15, 12, 11};
+    unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+    unsigned long kraft, bits, optimal = 0;
+    unsigned int l, longest;
+    size_t i;
+    int ok = 1;
+
+    printf("%s:\n", name);
+    for (l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+    {
+        if (!huffman_code_lengths(freq, size, limits[l], lengths))
+            return (0);
+        for (i = 0, bits = 0, kraft = 0, longest = 0; i < size; i++)
+        {
+            bits += (unsigned long)freq[i] * lengths[i];
+            if (lengths[i])
+                kraft += 1UL << (62 - lengths[i]);
+            if (lengths[i] > longest)
+                longest = lengths[i];
+        }
+        optimal = l ? optimal : bits;
+        ok &= kraft == 1UL << 62 && (!limits[l] || longest <= limits[l]);
+        printf("  limit %2u: longest %2u bits, %12lu bits, +%.4f%%%s\n",
+            limits[l], longest, bits, (double)(bits - optimal) * 100 / optimal,
+            kraft == 1UL << 62 ? "" : " INCOMPLETE");
+    }
+    return (ok);
+}
+
+/**
+ * bench_decode - Encodes data with codes of limited length and times its
+ * decoding
+ *
+ * @data: Bytes to encode
+ * @freq: Frequencies of the bytes
+ * @max_length: Longest code length allowed, 0 for no limit
+ *
+ * Return: 1 if the data decodes back, 0 otherwise
+ */
+int bench_decode(const unsigned char *data, const size_t *freq,
+    unsigned int max_length)
+{
+    unsigned char lengths[HUFFMAN_NB_SYMBOLS], *encoded, *decoded;
+    huffman_code_t codes[HUFFMAN_NB_SYMBOLS];
+    huffman_decoder_t *decoder;
+    size_t size;
+    clock_t start;
+    double seconds;
+    int ok;
+
+    encoded = malloc(DATA_SIZE);
+    decoded = malloc(DATA_SIZE);
+    if (!encoded || !decoded ||
+        !huffman_code_lengths(freq, HUFFMAN_NB_SYMBOLS, max_length, lengths) ||
+        !huffman_canonical_codes(lengths, HUFFMAN_NB_SYMBOLS, codes))
+        return (0);
+    decoder = huffman_decoder_create(lengths, HUFFMAN_NB_SYMBOLS);
+    size = huffman_encode(codes, data, DATA_SIZE, encoded, DATA_SIZE);
+    if (!decoder || !size)
+        return (0);
+    start = clock();
+    ok = huffman_decode(decoder, encoded, size, decoded, DATA_SIZE) &&
+        !memcmp(data, decoded, DATA_SIZE);
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("  limit %2u: longest %2u bits, %lu bytes, %s, %.0f MB/s\n",
+        max_length, decoder->max_length, size, ok ? "ok" : "MISMATCH",
+        DATA_SIZE / seconds / 1e6);
+    huffman_decoder_delete(decoder);
+    free(encoded);
+    free(decoded);
+    return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares the size of the data coded with unlimited codes and with codes
+ * limited by package-merge, and the decoding speed of both on skewed
+ * data, where the unlimited codes don't fit in the primary table
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    unsigned char *data;
+    size_t freq[HUFFMAN_NB_SYMBOLS], i;
+    int ok = 1;
+
+    data = malloc(DATA_SIZE);
+    if (!data)
+        return (EXIT_FAILURE);
+    srand(42);
+
+    make_text(data, DATA_SIZE);
+    huffman_histogram(data, DATA_SIZE, memset(freq, 0, sizeof(freq)));
+    ok &= report_limits("Text", freq, HUFFMAN_NB_SYMBOLS);
+
+    make_skewed(data, DATA_SIZE);
+    huffman_histogram(data, DATA_SIZE, memset(freq, 0, sizeof(freq)));
+    ok &= report_limits("Skewed", freq, HUFFMAN_NB_SYMBOLS);
+
+    for (i = 0; i < NB_FIBONACCI; i++)
+        freq[i] = i < 2 ? 1 : freq[i - 1] + freq[i - 2];
+    ok &= report_limits("Fibonacci", freq, NB_FIBONACCI);
+
+    printf("Skewed decoding:\n");
+    make_skewed(data, DATA_SIZE);
+    huffman_histogram(data, DATA_SIZE, memset(freq, 0, sizeof(freq)));
+    ok &= bench_decode(data, freq, 0);
+    ok &= bench_decode(data, freq, HUFFMAN_TABLE_BITS);
+
+    free(data);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
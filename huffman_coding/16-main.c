@@ -0,0 +1,168 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "huffman.h"
+
+#define TEXT_SIZE (16 << 20)
+#define ROUNDS 4
+
+/**
+ * make_text - Generates English-like text, words being drawn with a
+ * Zipf-like distribution
+ *
+ * @text: Buffer to fill
+ * @size: Size of @text
+ */
+void make_text(unsigned char *text, size_t size)
+{
+    static const char * const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+        "as", "was", "with", "be", "by", "on", "not", "he", "this", "are",
+        "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her",
+        "has", "there", "been", "if", "more", "when", "will", "would",
+        "who", "so", "no", "Huffman", "coding", "table", "decoder,",
+        "symbols.", "frequency", "(bits)", "42", "1952;", "\"quoted\""
+    };
+    size_t nb_words = sizeof(words) / sizeof(words[0]), i = 0, len, w;
+
+    while (i < size)
+    {
+        w = (size_t)rand() % nb_words;
+        w = w * ((size_t)rand() % nb_words) / nb_words;
+        len = strlen(words[w]);
+        if (i + len + 1 > size)
+            break;
+        memcpy(text + i, words[w], len);
+        i += len;
+        text[i++] = rand() % 12 ? ' ' : '\n';
+    }
+    memset(text + i, ' ', size - i);
+}
+
+/**
+ * bench_decoders - Compares the decoding speed of a single stream and of
+ * interleaved streams on the same text
+ *
+ * @text: Text to encode
+ *
+ * Return: 1 if both decode back to @text, 0 otherwise
+ */
+int bench_decoders(const unsigned char *text)
+{
+    unsigned char lengths[HUFFMAN_NB_SYMBOLS], *encoded, *decoded;
+    huffman_code_t codes[HUFFMAN_NB_SYMBOLS];
+    size_t freq[HUFFMAN_NB_SYMBOLS] = {0}, size, size4, r;
+    huffman_decoder_t *decoder;
+    clock_t start;
+    double single_time, interleaved_time;
+    int ok = 1;
+
+    encoded = malloc(TEXT_SIZE);
+    decoded = malloc(TEXT_SIZE);
+    huffman_histogram(text, TEXT_SIZE, freq);
+    if (!encoded || !decoded || !huffman_code_lengths(freq,
+        HUFFMAN_NB_SYMBOLS, HUFFMAN_TABLE_BITS, lengths) ||
+        !huffman_canonical_codes(lengths, HUFFMAN_NB_SYMBOLS, codes))
+        return (0);
+    decoder = huffman_decoder_create(lengths, HUFFMAN_NB_SYMBOLS);
+    if (!decoder)
+        return (0);
+
+    size = huffman_encode(codes, text, TEXT_SIZE, encoded, TEXT_SIZE);
+    start = clock();
+    for (r = 0; r < ROUNDS; r++)
+        ok &= huffman_decode(decoder, encoded, size, decoded, TEXT_SIZE);
+    single_time = (double)(clock() - start) / CLOCKS_PER_SEC / ROUNDS;
+    ok &= !memcmp(text, decoded, TEXT_SIZE);
+
+    memset(decoded, 0, TEXT_SIZE);
+    size4 = huffman_encode4(codes, text, TEXT_SIZE, encoded, TEXT_SIZE);
+    start = clock();
+    for (r = 0; r < ROUNDS; r++)
+        ok &= huffman_decode4(decoder, encoded, size4, decoded, TEXT_SIZE);
+    interleaved_time = (double)(clock() - start) / CLOCKS_PER_SEC / ROUNDS;
+    ok &= size && size4 && !memcmp(text, decoded, TEXT_SIZE);
+
+    printf("Single stream: %lu bytes, %4.0f MB/s\n", size,
+        TEXT_SIZE / single_time / 1e6);
+    printf("%d streams:     %lu bytes, %4.0f MB/s (%.2fx), %s\n",
+        HUFFMAN_NB_STREAMS, size4, TEXT_SIZE / interleaved_time / 1e6,
+        single_time / interleaved_time, ok ? "ok" : "MISMATCH");
+    huffman_decoder_delete(decoder);
+    free(encoded);
+    free(decoded);
+    return (ok);
+}
+
+/**
+ * round_trip - Compresses text to interleaved blocks and decompresses it
+ * with 1 and 4 threads
+ *
+ * @text: Text to compress
+ *
+ * Return: 1 if the text comes back, 0 otherwise
+ */
+int round_trip(const unsigned char *text)
+{
+    FILE *raw, *packed, *unpacked;
+    unsigned char *check;
+    size_t threads;
+    long size;
+    int ok;
+
+    check = malloc(TEXT_SIZE);
+    raw = tmpfile();
+    packed = tmpfile();
+    if (!check || !raw || !packed)
+        return (0);
+    fwrite(text, 1, TEXT_SIZE, raw);
+    fflush(raw);
+    rewind(raw);
+    ok = huffman_compress_stream(fileno(raw), fileno(packed),
+        HUFFMAN_FLAG_INTERLEAVED);
+    size = lseek(fileno(packed), 0, SEEK_CUR);
+    for (threads = 1; ok && threads <= 4; threads *= 4)
+    {
+        unpacked = tmpfile();
+        lseek(fileno(packed), 0, SEEK_SET);
+        ok = unpacked && huffman_decompress_stream_mt(fileno(packed),
+            fileno(unpacked), threads);
+        ok = ok && pread(fileno(unpacked), check, TEXT_SIZE, 0) ==
+            TEXT_SIZE && !memcmp(text, check, TEXT_SIZE);
+        if (unpacked)
+            fclose(unpacked);
+    }
+    printf("Interleaved stream: %d -> %ld bytes, round trip %s\n",
+        TEXT_SIZE, size, ok ? "ok" : "FAILED");
+    fclose(raw);
+    fclose(packed);
+    free(check);
+    return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares the decoding speed of a single Huffman stream and of
+ * interleaved streams, and runs a round trip through interleaved blocks
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    unsigned char *text;
+    int ok;
+
+    text = malloc(TEXT_SIZE);
+    if (!text)
+        return (EXIT_FAILURE);
+    srand(42);
+    make_text(text, TEXT_SIZE);
+    ok = bench_decoders(text);
+    ok = round_trip(text) && ok;
+    free(text);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,132 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "heap.h"
+#include "huffman.h"
+
+#define NB_TOKENS 65536
+#define STREAM_SIZE (4 << 20)
+
+/**
+ * make_tokens - Generates a stream of token ids with a Zipf-like
+ * distribution, ids 0xFF and NB_TOKENS - 1 being among the most common
+ *
+ * @tokens: Buffer to fill
+ * @size: Number of tokens
+ */
+void make_tokens(huffman_symbol_t *tokens, size_t size)
+{
+    size_t i, t;
+
+    for (i = 0; i < size; i++)
+    {
+        t = (size_t)rand() % NB_TOKENS;
+        t = t * ((size_t)rand() % NB_TOKENS) / NB_TOKENS;
+        t = t * ((size_t)rand() % NB_TOKENS) / NB_TOKENS;
+        tokens[i] = t == 1 ? NB_TOKENS - 1 : t == 2 ? 0xFF : t;
+    }
+}
+
+/**
+ * check_tree - Builds the Huffman tree of the tokens and checks its codes
+ * against the code lengths computed without a tree
+ *
+ * @freq: Frequency of each token
+ * @lengths: Code length of each token
+ *
+ * Return: 1 if each token has a code of the same length, 0 otherwise
+ */
+int check_tree(const size_t *freq, const unsigned char *lengths)
+{
+    huffman_symbol_t *data;
+    size_t *tree_freq, i, nb_symbols = 0;
+    huffman_code_t *codes;
+    binary_tree_node_t *root = NULL;
+    int ok;
+
+    data = malloc(sizeof(*data) * NB_TOKENS);
+    tree_freq = malloc(sizeof(*tree_freq) * NB_TOKENS);
+    codes = malloc(sizeof(*codes) * NB_TOKENS);
+    for (i = 0; data && tree_freq && i < NB_TOKENS; i++)
+    {
+        if (!freq[i])
+            continue;
+        data[nb_symbols] = i;
+        tree_freq[nb_symbols++] = freq[i];
+    }
+    if (data && tree_freq && codes)
+        root = huffman_tree(data, tree_freq, nb_symbols);
+    ok = root && huffman_codes(root, codes, NB_TOKENS);
+    for (i = 0; ok && i < NB_TOKENS; i++)
+        ok = codes[i].length == lengths[i];
+    printf("Tree of %lu tokens: codes %s\n", nb_symbols,
+        ok ? "match" : "DIFFERENT");
+    free(root);
+    free(data);
+    free(tree_freq);
+    free(codes);
+    return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * Codes a stream of 16-bit token ids, checks that the Huffman tree and
+ * the canonical codes agree, and decodes the stream back
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    huffman_symbol_t *tokens, *decoded;
+    unsigned char *encoded, *lengths;
+    huffman_code_t *codes;
+    huffman_decoder_t *decoder = NULL;
+    size_t *freq, i, size = 0;
+    clock_t start;
+    double seconds;
+    int ok;
+
+    tokens = malloc(sizeof(*tokens) * STREAM_SIZE);
+    decoded = malloc(sizeof(*decoded) * STREAM_SIZE);
+    encoded = malloc(sizeof(*tokens) * STREAM_SIZE);
+    lengths = malloc(NB_TOKENS);
+    codes = malloc(sizeof(*codes) * NB_TOKENS);
+    freq = calloc(NB_TOKENS, sizeof(*freq));
+    if (!tokens || !decoded || !encoded || !lengths || !codes || !freq)
+        return (EXIT_FAILURE);
+    srand(42);
+    make_tokens(tokens, STREAM_SIZE);
+    for (i = 0; i < STREAM_SIZE; i++)
+        freq[tokens[i]]++;
+
+    ok = huffman_code_lengths(freq, NB_TOKENS, 0, lengths) &&
+        check_tree(freq, lengths) &&
+        huffman_code_lengths(freq, NB_TOKENS, HUFFMAN_MAX_CODE_LENGTH,
+        lengths) && huffman_canonical_codes(lengths, NB_TOKENS, codes);
+    if (ok)
+        decoder = huffman_decoder_create(lengths, NB_TOKENS);
+    if (decoder)
+        size = huffman_encode_symbols(codes, tokens, STREAM_SIZE, encoded,
+            sizeof(*tokens) * STREAM_SIZE);
+    start = clock();
+    ok = size && huffman_decode_symbols(decoder, encoded, size, decoded,
+        STREAM_SIZE) && !memcmp(tokens, decoded, sizeof(*tokens) *
+        STREAM_SIZE);
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("%d tokens -> %lu bytes, %.2f bits per token, longest code %u "
+        "bits\n", STREAM_SIZE, size, 8.0 * size / STREAM_SIZE,
+        decoder ? decoder->max_length : 0);
+    printf("Decoding: %.0f Mtokens/s, %s\n", STREAM_SIZE / seconds / 1e6,
+        ok ? "ok" : "MISMATCH");
+
+    huffman_decoder_delete(decoder);
+    free(tokens);
+    free(decoded);
+    free(encoded);
+    free(lengths);
+    free(codes);
+    free(freq);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,120 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "heap.h"
+#include "huffman.h"
+
+#define ROUNDS 2000
+
+/**
+ * nested_delete - Deallocates a tree of nested nodes and their symbols
+ *
+ * @node: Root of the tree
+ */
+void nested_delete(binary_tree_node_t *node)
+{
+    if (!node)
+        return;
+    nested_delete(node->left);
+    nested_delete(node->right);
+    free(node->data);
+    free(node);
+}
+
+/**
+ * tree_cost - Computes the number of bits a Huffman tree codes its
+ * symbols with
+ *
+ * @node: Root of the tree
+ * @depth: Depth of @node
+ *
+ * Return: Sum of the frequency times the depth of each leaf
+ */
+size_t tree_cost(const binary_tree_node_t *node, size_t depth)
+{
+    if (!node->left)
+        return (((symbol_t *)node->data)->freq * depth);
+    return (tree_cost(node->left, depth + 1) +
+        tree_cost(node->right, depth + 1));
+}
+
+/**
+ * bench - Builds the Huffman tree of random frequencies through the
+ * priority queue and through the node pool
+ *
+ * @size: Number of symbols
+ *
+ * Return: 1 if both trees are optimal, 0 otherwise
+ */
+int bench(size_t size)
+{
+    huffman_symbol_t *data;
+    size_t *freq, i, r, queue_cost = 0, pool_cost = 0;
+    heap_t *queue;
+    binary_tree_node_t *nested, *root;
+    clock_t start;
+    double queue_time, pool_time;
+
+    data = malloc(sizeof(*data) * size);
+    freq = malloc(sizeof(*freq) * size);
+    if (!data || !freq)
+        return (0);
+    for (i = 0; i < size; i++)
+    {
+        data[i] = i;
+        freq[i] = 1 + (size_t)rand() % 1000;
+    }
+
+    start = clock();
+    for (r = 0; r < ROUNDS; r++)
+    {
+        queue = huffman_priority_queue(data, freq, size);
+        while (queue && queue->size > 1)
+            huffman_extract_and_insert(queue);
+        nested = queue ? heap_extract(queue) : NULL;
+        if (nested)
+            queue_cost = tree_cost(nested, 0);
+        nested_delete(nested);
+        heap_delete(queue, NULL);
+    }
+    queue_time = (double)(clock() - start) / CLOCKS_PER_SEC / ROUNDS;
+
+    start = clock();
+    for (r = 0; r < ROUNDS; r++)
+    {
+        root = huffman_tree(data, freq, size);
+        if (root)
+            pool_cost = tree_cost(root, 0);
+        free(root);
+    }
+    pool_time = (double)(clock() - start) / CLOCKS_PER_SEC / ROUNDS;
+
+    printf("%5lu symbols: priority queue %7.1f us, node pool %6.1f us "
+        "(%.1fx), %s\n", size, queue_time * 1e6, pool_time * 1e6,
+        queue_time / pool_time,
+        queue_cost == pool_cost ? "same cost" : "DIFFERENT cost");
+    free(data);
+    free(freq);
+    return (queue_cost == pool_cost);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares building Huffman trees through the priority queue, which
+ * allocates the nodes one by one, and through the node pool, for the
+ * alphabet sizes of small blocks
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    int ok;
+
+    srand(42);
+    ok = bench(16);
+    ok = bench(64) && ok;
+    ok = bench(256) && ok;
+    ok = bench(1024) && ok;
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,120 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "heap.h"
+
+size_t nb_compares;
+
+/**
+ * int_cmp - Compares two integers, counting the comparisons
+ *
+ * @p1: First pointer
+ * @p2: Second pointer
+ *
+ * Return: Negative, zero or positive if the first integer is smaller,
+ * equal or greater than the second one
+ */
+int int_cmp(void *p1, void *p2)
+{
+    int n1, n2;
+
+    nb_compares++;
+    n1 = *(int *)p1;
+    n2 = *(int *)p2;
+    return ((n1 > n2) - (n1 < n2));
+}
+
+/**
+ * drain - Extracts every item of a heap, checking they come out sorted
+ *
+ * @heap: The heap, deleted once empty
+ * @n: Number of items in the heap
+ *
+ * Return: 1 if the n items came out sorted, 0 otherwise
+ */
+int drain(heap_t *heap, size_t n)
+{
+    int *prev = NULL, *extracted;
+    size_t i;
+    int sorted = 1;
+
+    for (i = 0; i < n; i++, prev = extracted)
+    {
+        extracted = heap_extract(heap);
+        sorted = sorted && extracted && (!prev || *prev <= *extracted);
+    }
+    sorted = sorted && !heap->size && !heap->root;
+    heap_delete(heap, NULL);
+    return (sorted);
+}
+
+/**
+ * bench - Builds a heap_t of random integers with heap_insert and with
+ * heap_create_from_array
+ *
+ * @n: Number of integers
+ *
+ * Return: 1 if both heaps give the integers back sorted, 0 otherwise
+ */
+int bench(size_t n)
+{
+    int *array;
+    void **items;
+    heap_t *heap;
+    size_t i, insert_compares, bulk_compares;
+    clock_t start;
+    double insert_time, bulk_time;
+    int ok;
+
+    array = malloc(sizeof(*array) * n);
+    items = malloc(sizeof(*items) * n);
+    if (!array || !items)
+        return (0);
+    for (i = 0; i < n; i++)
+    {
+        array[i] = rand();
+        items[i] = &array[i];
+    }
+
+    nb_compares = 0;
+    start = clock();
+    heap = heap_create(int_cmp);
+    for (i = 0; heap && i < n; i++)
+        heap_insert(heap, items[i]);
+    insert_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    insert_compares = nb_compares;
+    ok = heap && heap->size == n && drain(heap, n);
+
+    nb_compares = 0;
+    start = clock();
+    heap = heap_create_from_array(int_cmp, items, n);
+    bulk_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    bulk_compares = nb_compares;
+    ok = ok && heap && heap->size == n && drain(heap, n);
+
+    printf("%8lu items: inserts %7.2f ms %9lu compares, bulk %7.2f ms "
+        "%8lu compares, %s\n", n, insert_time * 1e3, insert_compares,
+        bulk_time * 1e3, bulk_compares, ok ? "ok" : "FAILED");
+    free(array);
+    free(items);
+    return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares building a heap_t by inserts and in one bottom-up pass
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    int ok = 1;
+    size_t n;
+
+    srand(42);
+    for (n = 1; n <= 1000000; n *= 10)
+        ok = bench(n) && ok;
+    ok = bench(0) && ok;
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,229 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "heap.h"
+
+#define NB_VERTICES 200000
+#define DEGREE 8
+#define NB_OPS 200000
+#define NB_KEYS 1000
+#define INFINITE ((size_t)-1)
+
+/**
+ * struct entry_s - Tentative distance of a vertex, as queued in a heap
+ * without decrease-key
+ *
+ * @dist: Distance of the vertex when it was queued
+ * @vertex: Index of the vertex
+ */
+typedef struct entry_s
+{
+    size_t dist;
+    size_t vertex;
+} entry_t;
+
+/**
+ * size_cmp - Compares two sizes
+ *
+ * @p1: First pointer
+ * @p2: Second pointer
+ *
+ * Return: Negative, zero or positive if the first size is smaller, equal
+ * or greater than the second one
+ */
+int size_cmp(void *p1, void *p2)
+{
+    size_t n1 = *(size_t *)p1, n2 = *(size_t *)p2;
+
+    return ((n1 > n2) - (n1 < n2));
+}
+
+/**
+ * random_ops - Runs random operations on an indexed heap, checking each
+ * result against a plain array
+ *
+ * Return: 1 if every result is right, 0 otherwise
+ */
+int random_ops(void)
+{
+    static size_t keys[NB_KEYS];
+    static int present[NB_KEYS];
+    indexed_heap_t *heap;
+    size_t i, h, min, handle;
+    void *data;
+    int ok = 1;
+
+    heap = indexed_heap_create(size_cmp, NB_KEYS);
+    if (!heap)
+        return (0);
+    for (i = 0; ok && i < NB_OPS; i++)
+    {
+        h = (size_t)rand() % NB_KEYS;
+        switch (rand() % 4)
+        {
+        case 0:
+            keys[h] = present[h] ? keys[h] : (size_t)rand() % 100000;
+            ok = indexed_heap_insert(heap, h, &keys[h]) == !present[h];
+            present[h] = 1;
+            break;
+        case 1:
+            keys[h] -= present[h] ? keys[h] / 2 : 0;
+            ok = indexed_heap_decrease_key(heap, h, &keys[h]) == present[h];
+            break;
+        case 2:
+            data = indexed_heap_remove(heap, h);
+            ok = present[h] ? data == &keys[h] : !data;
+            present[h] = 0;
+            break;
+        default:
+            for (min = INFINITE, h = 0; h < NB_KEYS; h++)
+                if (present[h] && keys[h] < min)
+                    min = keys[h];
+            data = indexed_heap_extract(heap, &handle);
+            ok = min == INFINITE ? !data : data && *(size_t *)data == min &&
+                data == &keys[handle] && present[handle];
+            if (data)
+                present[handle] = 0;
+        }
+    }
+    printf("%d random operations: %s\n", NB_OPS, ok ? "ok" : "FAILED");
+    indexed_heap_delete(heap, NULL);
+    return (ok);
+}
+
+/**
+ * dijkstra_indexed - Computes the distances from vertex 0 with an indexed
+ * heap, each vertex being queued at most once
+ *
+ * @targets: Targets of the edges, DEGREE per vertex
+ * @weights: Weights of the edges
+ * @dist: Receives the distance of each vertex
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int dijkstra_indexed(const size_t *targets, const size_t *weights,
+    size_t *dist)
+{
+    indexed_heap_t *heap;
+    size_t v, w, e;
+
+    heap = indexed_heap_create(size_cmp, NB_VERTICES);
+    if (!heap)
+        return (0);
+    for (v = 0; v < NB_VERTICES; v++)
+        dist[v] = INFINITE;
+    dist[0] = 0;
+    indexed_heap_insert(heap, 0, &dist[0]);
+    while (indexed_heap_extract(heap, &v))
+        for (e = v * DEGREE; e < (v + 1) * DEGREE; e++)
+        {
+            w = targets[e];
+            if (dist[v] + weights[e] >= dist[w])
+                continue;
+            if (dist[w] == INFINITE)
+            {
+                dist[w] = dist[v] + weights[e];
+                indexed_heap_insert(heap, w, &dist[w]);
+                continue;
+            }
+            dist[w] = dist[v] + weights[e];
+            indexed_heap_decrease_key(heap, w, &dist[w]);
+        }
+    indexed_heap_delete(heap, NULL);
+    return (1);
+}
+
+/**
+ * dijkstra_lazy - Computes the distances from vertex 0 with an array
+ * heap, a vertex being queued again each time its distance drops
+ *
+ * @targets: Targets of the edges, DEGREE per vertex
+ * @weights: Weights of the edges
+ * @dist: Receives the distance of each vertex
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int dijkstra_lazy(const size_t *targets, const size_t *weights,
+    size_t *dist)
+{
+    array_heap_t *heap;
+    entry_t *entries, *entry;
+    size_t v, w, e, nb_entries = 0;
+
+    heap = array_heap_create(size_cmp);
+    entries = malloc(sizeof(*entries) * (NB_VERTICES * DEGREE + 1));
+    if (!heap || !entries)
+        return (0);
+    for (v = 0; v < NB_VERTICES; v++)
+        dist[v] = INFINITE;
+    dist[0] = 0;
+    entries[0].dist = 0;
+    entries[nb_entries++].vertex = 0;
+    array_heap_insert(heap, &entries[0]);
+    while ((entry = array_heap_extract(heap)))
+    {
+        v = entry->vertex;
+        if (entry->dist > dist[v])
+            continue;
+        for (e = v * DEGREE; e < (v + 1) * DEGREE; e++)
+        {
+            w = targets[e];
+            if (dist[v] + weights[e] >= dist[w])
+                continue;
+            dist[w] = dist[v] + weights[e];
+            entries[nb_entries].dist = dist[w];
+            entries[nb_entries].vertex = w;
+            array_heap_insert(heap, &entries[nb_entries++]);
+        }
+    }
+    array_heap_delete(heap, NULL);
+    free(entries);
+    return (1);
+}
+
+/**
+ * main - Entry point
+ *
+ * Checks the indexed heap against a plain array, then compares Dijkstra's
+ * algorithm on a random graph with decrease-key and with a heap that
+ * queues vertices again
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    size_t *targets, *weights, *dist, *check, i;
+    clock_t start;
+    double indexed_time, lazy_time;
+    int ok;
+
+    srand(42);
+    ok = random_ops();
+    targets = malloc(sizeof(*targets) * NB_VERTICES * DEGREE);
+    weights = malloc(sizeof(*weights) * NB_VERTICES * DEGREE);
+    dist = malloc(sizeof(*dist) * NB_VERTICES);
+    check = malloc(sizeof(*check) * NB_VERTICES);
+    if (!targets || !weights || !dist || !check)
+        return (EXIT_FAILURE);
+    for (i = 0; i < NB_VERTICES * DEGREE; i++)
+    {
+        targets[i] = (size_t)rand() % NB_VERTICES;
+        weights[i] = 1 + (size_t)rand() % 1000;
+    }
+    start = clock();
+    ok = dijkstra_indexed(targets, weights, dist) && ok;
+    indexed_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    ok = dijkstra_lazy(targets, weights, check) && ok;
+    lazy_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    for (i = 0; ok && i < NB_VERTICES; i++)
+        ok = dist[i] == check[i];
+    printf("Dijkstra on %d vertices: decrease-key %.3f s, re-queueing "
+        "%.3f s, distances %s\n", NB_VERTICES, indexed_time, lazy_time,
+        ok ? "identical" : "DIFFERENT");
+    free(targets);
+    free(weights);
+    free(dist);
+    free(check);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,146 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "heap.h"
+
+/**
+ * key_cmp - Compares two keys
+ *
+ * @p1: First pointer
+ * @p2: Second pointer
+ *
+ * Return: Negative, zero or positive if the first key is smaller, equal
+ * or greater than the second one
+ */
+int key_cmp(void *p1, void *p2)
+{
+    unsigned long k1 = *(unsigned long *)p1, k2 = *(unsigned long *)p2;
+
+    return ((k1 > k2) - (k1 < k2));
+}
+
+/**
+ * random_workload - Inserts random keys, then extracts them all
+ *
+ * @heap: Empty heap
+ * @keys: Keys to insert
+ * @n: Number of keys
+ *
+ * Return: 1 if the keys came out sorted, 0 otherwise
+ */
+int random_workload(array_heap_t *heap, unsigned long *keys, size_t n)
+{
+    unsigned long *key, prev = 0;
+    size_t i;
+    int sorted = 1;
+
+    for (i = 0; i < n; i++)
+        if (!array_heap_insert(heap, &keys[i]))
+            return (0);
+    for (i = 0; i < n; i++)
+    {
+        key = array_heap_extract(heap);
+        sorted = sorted && key && *key >= prev;
+        prev = key ? *key : prev;
+    }
+    return (sorted && !heap->size);
+}
+
+/**
+ * timer_workload - Runs a queue of timers: the earliest one is extracted
+ * and rearmed later, so keys only grow, as they do in a scheduler
+ *
+ * @heap: Empty heap
+ * @keys: Keys of the timers
+ * @n: Number of timers
+ *
+ * Return: 1 if timers came out in order, 0 otherwise
+ */
+int timer_workload(array_heap_t *heap, unsigned long *keys, size_t n)
+{
+    unsigned long *key, prev = 0;
+    size_t i;
+    int sorted = 1;
+
+    for (i = 0; i < n; i++)
+        if (!array_heap_insert(heap, &keys[i]))
+            return (0);
+    for (i = 0; i < n; i++)
+    {
+        key = array_heap_extract(heap);
+        sorted = sorted && key && *key >= prev;
+        prev = *key;
+        *key += 1 + (unsigned long)rand();
+        array_heap_insert(heap, key);
+    }
+    return (sorted);
+}
+
+/**
+ * bench - Times a workload for each arity
+ *
+ * @name: Name of the workload
+ * @workload: The workload
+ * @n: Number of entries
+ *
+ * Return: 1 if every run succeeded, 0 otherwise
+ */
+int bench(const char *name, int (*workload)(array_heap_t *, unsigned long *,
+    size_t), size_t n)
+{
+    static const unsigned int arities[] = {2, 4, 8};
+    unsigned long *keys;
+    array_heap_t *heap;
+    size_t a, i;
+    clock_t start;
+    double seconds, binary = 0;
+    int ok = 1;
+
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys)
+        return (0);
+    printf("%-6s %8lu:", name, n);
+    for (a = 0; a < sizeof(arities) / sizeof(arities[0]); a++)
+    {
+        srand(42);
+        for (i = 0; i < n; i++)
+            keys[i] = (unsigned long)rand();
+        heap = array_heap_create_ex(key_cmp, arities[a]);
+        start = clock();
+        ok = heap && workload(heap, keys, n) && ok;
+        seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        binary = a ? binary : seconds;
+        printf("  %u-ary %7.3f s (%.2fx)", arities[a], seconds,
+            binary / seconds);
+        array_heap_delete(heap, NULL);
+    }
+    printf("  %s\n", ok ? "ok" : "FAILED");
+    free(keys);
+    return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares binary, 4-ary and 8-ary array heaps on random keys and on a
+ * queue of timers, for 10^5 entries up to the number given as argument,
+ * 10^7 by default
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int argc, char **argv)
+{
+    size_t n, max = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+    int ok = 1;
+
+    for (n = 100000; n <= max; n *= 10)
+    {
+        ok = bench("random", random_workload, n) && ok;
+        ok = bench("timers", timer_workload, n) && ok;
+    }
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
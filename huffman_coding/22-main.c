@@ -0,0 +1,175 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "heap.h"
+#include "radix_heap.h"
+
+#define INCREMENT 1000000
+
+/**
+ * key_cmp - Compares two keys
+ *
+ * @p1: First pointer
+ * @p2: Second pointer
+ *
+ * Return: Negative, zero or positive if the first key is smaller, equal
+ * or greater than the second one
+ */
+int key_cmp(void *p1, void *p2)
+{
+    size_t k1 = *(size_t *)p1, k2 = *(size_t *)p2;
+
+    return ((k1 > k2) - (k1 < k2));
+}
+
+/**
+ * timers_heap - Runs a queue of timers on a heap_t: the earliest timer is
+ * extracted and rearmed later, n times
+ *
+ * @keys: Keys of the timers, updated as they are rearmed
+ * @n: Number of timers
+ * @sum: Receives the sum of the keys extracted
+ *
+ * Return: 1 if the timers came out in order, 0 otherwise
+ */
+int timers_heap(size_t *keys, size_t n, size_t *sum)
+{
+    heap_t *heap;
+    size_t i, *key, prev = 0;
+    int sorted = 1;
+
+    heap = heap_create(key_cmp);
+    for (i = 0; heap && i < n; i++)
+        heap_insert(heap, &keys[i]);
+    for (*sum = i = 0; heap && i < n; i++)
+    {
+        key = heap_extract(heap);
+        sorted = sorted && *key >= prev;
+        *sum += prev = *key;
+        *key += 1 + (size_t)rand() % INCREMENT;
+        heap_insert(heap, key);
+    }
+    sorted = sorted && heap && heap->size == n;
+    heap_delete(heap, NULL);
+    return (sorted);
+}
+
+/**
+ * timers_array_heap - Runs a queue of timers on an 8-ary array_heap_t
+ *
+ * @keys: Keys of the timers, updated as they are rearmed
+ * @n: Number of timers
+ * @sum: Receives the sum of the keys extracted
+ *
+ * Return: 1 if the timers came out in order, 0 otherwise
+ */
+int timers_array_heap(size_t *keys, size_t n, size_t *sum)
+{
+    array_heap_t *heap;
+    size_t i, *key, prev = 0;
+    int sorted = 1;
+
+    heap = array_heap_create_ex(key_cmp, 8);
+    for (i = 0; heap && i < n; i++)
+        array_heap_insert(heap, &keys[i]);
+    for (*sum = i = 0; heap && i < n; i++)
+    {
+        key = array_heap_extract(heap);
+        sorted = sorted && *key >= prev;
+        *sum += prev = *key;
+        *key += 1 + (size_t)rand() % INCREMENT;
+        array_heap_insert(heap, key);
+    }
+    sorted = sorted && heap && heap->size == n;
+    array_heap_delete(heap, NULL);
+    return (sorted);
+}
+
+/**
+ * timers_radix_heap - Runs a queue of timers on a radix_heap_t
+ *
+ * @keys: Keys of the timers, updated as they are rearmed
+ * @n: Number of timers
+ * @sum: Receives the sum of the keys extracted
+ *
+ * Return: 1 if the timers came out in order, 0 otherwise
+ */
+int timers_radix_heap(size_t *keys, size_t n, size_t *sum)
+{
+    radix_heap_t *heap;
+    size_t i, *key, k, prev = 0;
+    int sorted = 1;
+
+    heap = radix_heap_create();
+    for (i = 0; heap && i < n; i++)
+        radix_heap_insert(heap, keys[i], &keys[i]);
+    for (*sum = i = 0; heap && i < n; i++)
+    {
+        key = radix_heap_extract(heap, &k);
+        sorted = sorted && k == *key && k >= prev;
+        *sum += prev = k;
+        *key += 1 + (size_t)rand() % INCREMENT;
+        radix_heap_insert(heap, *key, key);
+    }
+    sorted = sorted && heap && heap->size == n;
+    radix_heap_delete(heap, NULL);
+    return (sorted);
+}
+
+/**
+ * bench - Times a queue of timers on each kind of heap
+ *
+ * @n: Number of timers
+ *
+ * Return: 1 if every heap gave the same timers in order, 0 otherwise
+ */
+int bench(size_t n)
+{
+    static int (*const runs[])(size_t *, size_t, size_t *) = {
+        timers_heap, timers_array_heap, timers_radix_heap
+    };
+    static const char *const names[] = {"heap_t", "8-ary", "radix"};
+    size_t *keys, r, i, sum, first_sum = 0;
+    clock_t start;
+    double seconds, first = 0;
+    int ok = 1;
+
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys)
+        return (0);
+    printf("%8lu timers:", n);
+    for (r = 0; r < sizeof(runs) / sizeof(runs[0]); r++)
+    {
+        srand(42);
+        for (i = 0; i < n; i++)
+            keys[i] = (size_t)rand() % INCREMENT;
+        start = clock();
+        ok = runs[r](keys, n, &sum) && ok;
+        seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        first = r ? first : seconds;
+        first_sum = r ? first_sum : sum;
+        ok = ok && sum == first_sum;
+        printf("  %s %6.3f s (%4.1fx)", names[r], seconds, first / seconds);
+    }
+    printf("  %s\n", ok ? "ok" : "FAILED");
+    free(keys);
+    return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares a radix heap with the comparison heaps on a queue of timers,
+ * whose keys only grow
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    size_t n;
+    int ok = 1;
+
+    for (n = 10000; n <= 1000000; n *= 10)
+        ok = bench(n) && ok;
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
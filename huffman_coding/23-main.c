@@ -0,0 +1,230 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "heap.h"
+#include "multi_queue.h"
+
+#define NB_KEYS 100000
+#define NB_OPS 2000000
+#define MAX_THREADS 32
+#define HEAPS_PER_THREAD 2
+
+/**
+ * struct locked_heap_s - heap_t behind a single mutex
+ *
+ * @lock: Protects @heap
+ * @heap: The heap
+ */
+typedef struct locked_heap_s
+{
+    pthread_mutex_t lock;
+    heap_t *heap;
+} locked_heap_t;
+
+/**
+ * struct worker_s - Work of a benchmark thread
+ *
+ * @queue: MultiQueue to work on, or NULL
+ * @locked: Locked heap to work on if @queue is NULL
+ * @nb_ops: Number of pops, each one followed by a push
+ * @seed: Random state of the thread
+ */
+typedef struct worker_s
+{
+    multi_queue_t *queue;
+    locked_heap_t *locked;
+    size_t nb_ops;
+    unsigned int seed;
+} worker_t;
+
+/**
+ * key_cmp - Compares two keys
+ *
+ * @p1: First pointer
+ * @p2: Second pointer
+ *
+ * Return: Negative, zero or positive if the first key is smaller, equal
+ * or greater than the second one
+ */
+int key_cmp(void *p1, void *p2)
+{
+    size_t k1 = *(size_t *)p1, k2 = *(size_t *)p2;
+
+    return ((k1 > k2) - (k1 < k2));
+}
+
+/**
+ * now - Gets the wall clock time
+ *
+ * Return: Time in seconds
+ */
+double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * rank_error - Pops every key of a MultiQueue on one thread, measuring
+ * how many smaller keys were still queued each time
+ *
+ * @nb_heaps: Number of heaps of the queue
+ *
+ * Return: 1 if every key came out once, 0 otherwise
+ */
+int rank_error(size_t nb_heaps)
+{
+    static size_t keys[NB_KEYS];
+    static char present[NB_KEYS];
+    multi_queue_t *queue;
+    size_t i, j, tmp, *key, smallest = 0, rank, total = 0, max = 0;
+    unsigned int seed = 42;
+    int ok = 1;
+
+    queue = multi_queue_create(key_cmp, nb_heaps);
+    for (i = 0; i < NB_KEYS; i++)
+        keys[i] = i;
+    for (i = NB_KEYS - 1; i > 0; i--)
+    {
+        j = rand_r(&seed) % (i + 1);
+        tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+    for (i = 0; queue && i < NB_KEYS; i++)
+        present[i] = multi_queue_push(queue, &keys[i], &seed);
+    for (i = 0; queue && ok && i < NB_KEYS; i++)
+    {
+        key = multi_queue_pop(queue, &seed);
+        ok = key && present[*key];
+        for (rank = 0, j = smallest; ok && j < *key; j++)
+            rank += present[j];
+        total += rank;
+        max = rank > max ? rank : max;
+        present[ok ? *key : 0] = 0;
+        while (smallest < NB_KEYS && !present[smallest])
+            smallest++;
+    }
+    ok = queue && ok && !multi_queue_pop(queue, &seed);
+    printf("%3lu heaps: rank error %6.2f on average, %4lu at most, %s\n",
+        nb_heaps, (double)total / NB_KEYS, max, ok ? "ok" : "FAILED");
+    multi_queue_delete(queue, NULL);
+    return (ok);
+}
+
+/**
+ * worker - Pops keys and pushes them back later, as a scheduler does
+ *
+ * @arg: Pointer to the work of the thread
+ *
+ * Return: NULL
+ */
+void *worker(void *arg)
+{
+    worker_t *work = arg;
+    size_t i, *key;
+
+    for (i = 0; i < work->nb_ops; i++)
+    {
+        if (work->queue)
+            key = multi_queue_pop(work->queue, &work->seed);
+        else
+        {
+            pthread_mutex_lock(&work->locked->lock);
+            key = heap_extract(work->locked->heap);
+            pthread_mutex_unlock(&work->locked->lock);
+        }
+        *key += 1 + rand_r(&work->seed) % 1000;
+        if (work->queue)
+            multi_queue_push(work->queue, key, &work->seed);
+        else
+        {
+            pthread_mutex_lock(&work->locked->lock);
+            heap_insert(work->locked->heap, key);
+            pthread_mutex_unlock(&work->locked->lock);
+        }
+    }
+    return (NULL);
+}
+
+/**
+ * throughput - Runs the workers on a queue holding NB_KEYS keys
+ *
+ * @queue: MultiQueue to work on, or NULL
+ * @locked: Locked heap to work on if @queue is NULL
+ * @nb_threads: Number of threads
+ *
+ * Return: Millions of operations per second
+ */
+double throughput(multi_queue_t *queue, locked_heap_t *locked,
+    size_t nb_threads)
+{
+    static size_t keys[NB_KEYS];
+    pthread_t threads[MAX_THREADS];
+    worker_t work[MAX_THREADS];
+    unsigned int seed = 42;
+    size_t i;
+    double start;
+
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        keys[i] = rand_r(&seed) % 1000000;
+        if (queue)
+            multi_queue_push(queue, &keys[i], &seed);
+        else
+            heap_insert(locked->heap, &keys[i]);
+    }
+    start = now();
+    for (i = 0; i < nb_threads; i++)
+    {
+        work[i].queue = queue;
+        work[i].locked = locked;
+        work[i].nb_ops = NB_OPS / nb_threads;
+        work[i].seed = 1 + i;
+        pthread_create(&threads[i], NULL, worker, &work[i]);
+    }
+    for (i = 0; i < nb_threads; i++)
+        pthread_join(threads[i], NULL);
+    return (NB_OPS / nb_threads * nb_threads / (now() - start) / 1e6);
+}
+
+/**
+ * main - Entry point
+ *
+ * Measures the rank error of MultiQueues, then compares their throughput
+ * with a heap_t behind a mutex, from 1 to MAX_THREADS threads
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    multi_queue_t *queue;
+    locked_heap_t locked;
+    size_t nb_threads;
+    double locked_ops, queue_ops;
+    int ok = 1;
+
+    for (nb_threads = 2; nb_threads <= 128; nb_threads *= 4)
+        ok = rank_error(nb_threads) && ok;
+    pthread_mutex_init(&locked.lock, NULL);
+    for (nb_threads = 1; ok && nb_threads <= MAX_THREADS; nb_threads *= 2)
+    {
+        locked.heap = heap_create(key_cmp);
+        queue = multi_queue_create(key_cmp, HEAPS_PER_THREAD * nb_threads);
+        ok = locked.heap && queue;
+        if (ok)
+        {
+            locked_ops = throughput(NULL, &locked, nb_threads);
+            queue_ops = throughput(queue, NULL, nb_threads);
+            printf("%2lu threads: locked heap_t %5.2f Mops/s, MultiQueue of "
+                "%2lu heaps %5.2f Mops/s (%.1fx)\n", nb_threads, locked_ops,
+                queue->nb_heaps, queue_ops, queue_ops / locked_ops);
+        }
+        heap_delete(locked.heap, NULL);
+        multi_queue_delete(queue, NULL);
+    }
+    pthread_mutex_destroy(&locked.lock);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
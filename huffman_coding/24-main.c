@@ -0,0 +1,170 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "huffman_stream.h"
+
+#define DATA_SIZE (8 << 20)
+
+/**
+ * make_text - Generates English-like text, words being drawn with a
+ * Zipf-like distribution
+ *
+ * @text: Buffer to fill
+ * @size: Size of @text
+ */
+void make_text(unsigned char *text, size_t size)
+{
+    static const char * const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+        "as", "was", "with", "be", "by", "on", "not", "he", "this", "are",
+        "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her",
+        "has", "there", "been", "if", "more", "when", "will", "would",
+        "who", "so", "no", "Huffman", "coding", "table", "decoder,",
+        "symbols.", "frequency", "(bits)", "42", "1952;", "\"quoted\""
+    };
+    size_t nb_words = sizeof(words) / sizeof(words[0]), i = 0, len, w;
+
+    while (i < size)
+    {
+        w = (size_t)rand() % nb_words;
+        w = w * ((size_t)rand() % nb_words) / nb_words;
+        len = strlen(words[w]);
+        if (i + len + 1 > size)
+            break;
+        memcpy(text + i, words[w], len);
+        i += len;
+        text[i++] = rand() % 12 ? ' ' : '\n';
+    }
+    memset(text + i, ' ', size - i);
+}
+
+/**
+ * make_geometric - Generates bytes with a geometric distribution, byte n
+ * being drawn with a probability proportional to (@percent / 100)^n
+ *
+ * @data: Buffer to fill
+ * @size: Size of @data
+ * @percent: Ratio of the probabilities of two consecutive bytes, in %
+ */
+void make_geometric(unsigned char *data, size_t size, int percent)
+{
+    size_t i;
+    unsigned char byte;
+
+    for (i = 0; i < size; i++)
+    {
+        for (byte = 0; byte < 255 && rand() % 100 < percent; byte++)
+            ;
+        data[i] = byte;
+    }
+}
+
+/**
+ * run - Compresses data block by block, then decompresses it
+ *
+ * @data: Data to compress, of DATA_SIZE bytes
+ * @flags: Options of the compressor
+ * @packed: Receives the compressed blocks
+ * @check: Receives the decompressed data
+ * @nb_tans: Receives the number of tANS blocks
+ * @seconds: Receives the decompression time
+ *
+ * Return: Size of the compressed blocks, or 0 if the round trip failed
+ */
+size_t run(const unsigned char *data, unsigned int flags,
+    unsigned char *packed, unsigned char *check, size_t *nb_tans,
+    double *seconds)
+{
+    size_t offset, size = 0, done = 0, block_size;
+    clock_t start;
+    int ok = 1;
+
+    *nb_tans = 0;
+    for (offset = 0; offset < DATA_SIZE; offset += HUFFMAN_BLOCK_SIZE)
+    {
+        block_size = huffman_block_compress(data + offset, HUFFMAN_BLOCK_SIZE,
+            flags, NULL, packed + size);
+        *nb_tans += packed[size] == HUFFMAN_BLOCK_TANS;
+        size += block_size;
+    }
+    start = clock();
+    for (offset = 0; ok && offset < size; offset += block_size)
+    {
+        block_size = HUFFMAN_BLOCK_HEADER_SIZE + load_be32(packed + offset + 5);
+        ok = huffman_block_decompress(packed + offset,
+            packed + offset + HUFFMAN_BLOCK_HEADER_SIZE, NULL, check + done);
+        done += load_be32(packed + offset + 1);
+    }
+    *seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    ok = ok && done == DATA_SIZE && !memcmp(data, check, DATA_SIZE);
+    return (ok ? size : 0);
+}
+
+/**
+ * compare - Compresses data with Huffman blocks only, then letting blocks
+ * use tANS
+ *
+ * @name: Name of the data
+ * @data: Data to compress, of DATA_SIZE bytes
+ *
+ * Return: 1 if both round trips succeeded, 0 otherwise
+ */
+int compare(const char *name, const unsigned char *data)
+{
+    unsigned char *packed, *check;
+    size_t huffman_size, tans_size, nb_tans;
+    double huffman_time, tans_time;
+
+    packed = malloc(DATA_SIZE / HUFFMAN_BLOCK_SIZE * HUFFMAN_BLOCK_BOUND);
+    check = malloc(DATA_SIZE);
+    if (!packed || !check)
+        return (0);
+    huffman_size = run(data, 0, packed, check, &nb_tans, &huffman_time);
+    tans_size = run(data, HUFFMAN_FLAG_TANS, packed, check, &nb_tans,
+        &tans_time);
+    printf("%-12s Huffman %5.1f%% %4.0f MB/s, with tANS %5.1f%% %4.0f MB/s,"
+        " %2lu/%d tANS blocks, %s\n", name, 100.0 * huffman_size / DATA_SIZE,
+        DATA_SIZE / huffman_time / 1e6, 100.0 * tans_size / DATA_SIZE,
+        DATA_SIZE / tans_time / 1e6, nb_tans, DATA_SIZE / HUFFMAN_BLOCK_SIZE,
+        huffman_size && tans_size ? "ok" : "FAILED");
+    free(packed);
+    free(check);
+    return (huffman_size && tans_size);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares the ratio and decoding speed of Huffman blocks and of blocks
+ * choosing between Huffman and tANS, on text, on bytes of geometric
+ * distributions, the most skewed one being where Huffman codes waste the
+ * most, and on random bytes
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    unsigned char *data;
+    size_t i;
+    int ok;
+
+    data = malloc(DATA_SIZE);
+    if (!data)
+        return (EXIT_FAILURE);
+    srand(42);
+    make_text(data, DATA_SIZE);
+    ok = compare("text", data);
+    make_geometric(data, DATA_SIZE, 50);
+    ok = compare("geometric 50", data) && ok;
+    make_geometric(data, DATA_SIZE, 80);
+    ok = compare("geometric 80", data) && ok;
+    make_geometric(data, DATA_SIZE, 5);
+    ok = compare("geometric 5", data) && ok;
+    for (i = 0; i < DATA_SIZE; i++)
+        data[i] = rand();
+    ok = compare("random", data) && ok;
+    free(data);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
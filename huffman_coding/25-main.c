@@ -0,0 +1,248 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "huffman_stream.h"
+
+#define DATA_SIZE (8 << 20)
+
+/**
+ * make_text - Generates English-like text, words being drawn with a
+ * Zipf-like distribution
+ *
+ * @text: Buffer to fill
+ * @size: Size of @text
+ */
+void make_text(unsigned char *text, size_t size)
+{
+    static const char * const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+        "as", "was", "with", "be", "by", "on", "not", "he", "this", "are",
+        "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her",
+        "has", "there", "been", "if", "more", "when", "will", "would",
+        "who", "so", "no", "Huffman", "coding", "table", "decoder,",
+        "symbols.", "frequency", "(bits)", "42", "1952;", "\"quoted\""
+    };
+    size_t nb_words = sizeof(words) / sizeof(words[0]), i = 0, len, w;
+
+    while (i < size)
+    {
+        w = (size_t)rand() % nb_words;
+        w = w * ((size_t)rand() % nb_words) / nb_words;
+        len = strlen(words[w]);
+        if (i + len + 1 > size)
+            break;
+        memcpy(text + i, words[w], len);
+        i += len;
+        text[i++] = rand() % 12 ? ' ' : '\n';
+    }
+    memset(text + i, ' ', size - i);
+}
+
+/**
+ * header_sizes - Computes the size of the code lengths of each block of
+ * text, stored 5 bits each and with huffman_lengths_write
+ *
+ * @text: Text, of DATA_SIZE bytes
+ * @block_size: Size of the blocks
+ * @packed: Receives the total size of the lengths stored 5 bits each
+ * @rle: Receives the total size of the lengths written with
+ *   huffman_lengths_write
+ */
+void header_sizes(const unsigned char *text, size_t block_size,
+    size_t *packed, size_t *rle)
+{
+    unsigned char lengths[HUFFMAN_NB_SYMBOLS], out[HUFFMAN_LENGTHS_BOUND];
+    size_t freq[HUFFMAN_NB_SYMBOLS], offset, last;
+
+    *packed = 0;
+    *rle = 0;
+    for (offset = 0; offset < DATA_SIZE; offset += block_size)
+    {
+        memset(freq, 0, sizeof(freq));
+        huffman_histogram(text + offset, block_size, freq);
+        huffman_code_lengths(freq, HUFFMAN_NB_SYMBOLS, HUFFMAN_TABLE_BITS,
+            lengths);
+        for (last = HUFFMAN_NB_SYMBOLS - 1; last > 0 && !lengths[last]; last--)
+            ;
+        *packed += 1 + ((last + 1) * HUFFMAN_LENGTH_BITS + 7) / 8;
+        *rle += huffman_lengths_write(lengths, out, sizeof(out));
+    }
+}
+
+/**
+ * run - Compresses text in blocks of a given size, then decompresses it
+ *
+ * @text: Text to compress, of DATA_SIZE bytes
+ * @block_size: Size of the blocks
+ * @reuse: 1 to let blocks reuse the code lengths of the block before
+ * @packed: Receives the compressed blocks
+ * @check: Receives the decompressed text
+ * @modes: Receives the number of blocks of each HUFFMAN_TABLE_* mode
+ * @seconds: Receives the decompression time
+ *
+ * Return: Size of the compressed blocks, or 0 if the round trip failed
+ */
+size_t run(const unsigned char *text, size_t block_size, int reuse,
+    unsigned char *packed, unsigned char *check, size_t *modes,
+    double *seconds)
+{
+    huffman_table_t table;
+    size_t offset, size = 0, done = 0, length;
+    clock_t start;
+    int ok = 1, mode;
+
+    memset(modes, 0, sizeof(*modes) * 4);
+    huffman_table_init(&table);
+    for (offset = 0; offset < DATA_SIZE; offset += block_size)
+    {
+        length = huffman_block_compress(text + offset, block_size, 0,
+            reuse ? &table : NULL, packed + size);
+        mode = huffman_table_mode(packed[size]);
+        if (mode != -1)
+            modes[mode >> 4]++;
+        size += length;
+    }
+    huffman_table_clear(&table);
+    start = clock();
+    for (offset = 0; ok && offset < size; offset += length)
+    {
+        length = HUFFMAN_BLOCK_HEADER_SIZE + load_be32(packed + offset + 5);
+        ok = huffman_block_decompress(packed + offset,
+            packed + offset + HUFFMAN_BLOCK_HEADER_SIZE,
+            reuse ? &table : NULL, check + done);
+        done += load_be32(packed + offset + 1);
+    }
+    *seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    huffman_table_clear(&table);
+    ok = ok && done == DATA_SIZE && !memcmp(text, check, DATA_SIZE);
+    return (ok ? size : 0);
+}
+
+/**
+ * stream_round_trip - Compresses data to a stream whose blocks may reuse
+ * the code lengths of the block before, then decompresses it with 1
+ * thread, and with 4 threads from a file then from a pipe
+ *
+ * @data: Data to compress, of DATA_SIZE bytes
+ *
+ * Return: 1 if the data comes back every time, 0 otherwise
+ */
+int stream_round_trip(const unsigned char *data)
+{
+    static const char * const names[] = {
+        "1 thread, from a file", "4 threads, from a file",
+        "4 threads, from a pipe"
+    };
+    FILE *raw, *packed, *unpacked;
+    unsigned char *check;
+    int ok, fd, fds[2], i;
+    size_t n;
+    pid_t pid = -1;
+
+    check = malloc(DATA_SIZE);
+    raw = tmpfile();
+    packed = tmpfile();
+    if (!check || !raw || !packed)
+        return (0);
+    ok = fwrite(data, 1, DATA_SIZE, raw) == DATA_SIZE && !fflush(raw);
+    rewind(raw);
+    ok = ok && huffman_compress_stream(fileno(raw), fileno(packed),
+        HUFFMAN_FLAG_REUSE);
+    printf("Stream: %d -> %ld bytes\n", DATA_SIZE, ftell(packed));
+    for (i = 0; ok && i < 3; i++)
+    {
+        unpacked = tmpfile();
+        rewind(packed);
+        fd = fileno(packed);
+        if (i == 2 && (pipe(fds) || (pid = fork()) == -1))
+            break;
+        if (i == 2 && pid == 0)
+        {
+            close(fds[0]);
+            while ((n = huffman_read_full(fd, check, DATA_SIZE)) &&
+                n != (size_t)-1 && huffman_write_full(fds[1], check, n))
+                ;
+            _exit(0);
+        }
+        if (i == 2)
+            close(fds[1]);
+        fd = i == 2 ? fds[0] : fd;
+        ok = unpacked && (i ? huffman_decompress_stream_mt(fd,
+            fileno(unpacked), 4) : huffman_decompress_stream(fd,
+            fileno(unpacked)));
+        if (i == 2)
+            close(fds[0]), waitpid(pid, NULL, 0);
+        rewind(unpacked);
+        ok = ok && fread(check, 1, DATA_SIZE, unpacked) == DATA_SIZE &&
+            !memcmp(data, check, DATA_SIZE);
+        printf("  %s: %s\n", names[i], ok ? "ok" : "FAILED");
+        if (unpacked)
+            fclose(unpacked);
+    }
+    fclose(raw);
+    fclose(packed);
+    free(check);
+    return (ok && i == 3);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compares, on text cut into blocks of 256 bytes to 64 KB, the size of the code
+ * lengths stored 5 bits each and with huffman_lengths_write, then the
+ * ratio and decoding speed of blocks each storing or naming their
+ * lengths and of blocks that may reuse those of the block before. Then
+ * checks a stream mixing text, random bytes and digits, reusing lengths
+ * across raw blocks, through the decompressors.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    unsigned char *text, *packed, *check;
+    size_t block_size, packed_size, rle_size, size, reuse_size, i;
+    size_t modes[4], reuse_modes[4];
+    double seconds, reuse_seconds;
+    int ok = 1;
+
+    text = malloc(DATA_SIZE);
+    packed = malloc(DATA_SIZE + DATA_SIZE / 256 * HUFFMAN_BLOCK_HEADER_SIZE);
+    check = malloc(DATA_SIZE);
+    if (!text || !packed || !check)
+        return (EXIT_FAILURE);
+    srand(42);
+    make_text(text, DATA_SIZE);
+    printf(" block lengths: 5 bits   RLE | own table: size  MB/s   RLE"
+        "  pre | reuse: size  MB/s   RLE  pre reuse\n");
+    for (block_size = 256; block_size <= 64 << 10; block_size *= 4)
+    {
+        header_sizes(text, block_size, &packed_size, &rle_size);
+        size = run(text, block_size, 0, packed, check, modes, &seconds);
+        reuse_size = run(text, block_size, 1, packed, check, reuse_modes,
+            &reuse_seconds);
+        printf("%6lu %16.1f %5.1f | %14.1f%% %5.0f %5lu %4lu |"
+            " %10.1f%% %5.0f %5lu %4lu %5lu %s\n", block_size,
+            (double)packed_size * block_size / DATA_SIZE,
+            (double)rle_size * block_size / DATA_SIZE,
+            100.0 * size / DATA_SIZE, DATA_SIZE / seconds / 1e6,
+            modes[1], modes[3], 100.0 * reuse_size / DATA_SIZE,
+            DATA_SIZE / reuse_seconds / 1e6, reuse_modes[1],
+            reuse_modes[3], reuse_modes[2],
+            size && reuse_size ? "ok" : "FAILED");
+        ok = ok && size && reuse_size;
+    }
+    for (i = 0; i < DATA_SIZE; i++)
+        if (i / HUFFMAN_BLOCK_SIZE % 8 == 3)
+            text[i] = rand();
+        else if (i / HUFFMAN_BLOCK_SIZE % 8 == 6)
+            text[i] = '0' + rand() % 10;
+    ok = stream_round_trip(text) && ok;
+    free(text);
+    free(packed);
+    free(check);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,249 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "huffman_stream.h"
+
+#define NB_MESSAGES 50000
+#define SAMPLE_SIZE (1 << 20)
+
+/**
+ * make_text - Generates English-like text, words being drawn with a
+ * Zipf-like distribution
+ *
+ * @text: Buffer to fill
+ * @size: Size of @text
+ */
+void make_text(unsigned char *text, size_t size)
+{
+    static const char * const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+        "as", "was", "with", "be", "by", "on", "not", "he", "this", "are",
+        "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her",
+        "has", "there", "been", "if", "more", "when", "will", "would",
+        "who", "so", "no", "Huffman", "coding", "table", "decoder,",
+        "symbols.", "frequency", "(bits)", "42", "1952;", "\"quoted\""
+    };
+    size_t nb_words = sizeof(words) / sizeof(words[0]), i = 0, len, w;
+
+    while (i < size)
+    {
+        w = (size_t)rand() % nb_words;
+        w = w * ((size_t)rand() % nb_words) / nb_words;
+        len = strlen(words[w]);
+        if (i + len + 1 > size)
+            break;
+        memcpy(text + i, words[w], len);
+        i += len;
+        text[i++] = rand() % 12 ? ' ' : '\n';
+    }
+    memset(text + i, ' ', size - i);
+}
+
+/**
+ * make_message - Generates a JSON-RPC request of about 200 bytes
+ *
+ * @message: Buffer receiving the request, of at least 512 bytes
+ *
+ * Return: Length of the request
+ */
+size_t make_message(unsigned char *message)
+{
+    static const char * const methods[] = {
+        "user.get", "user.update", "order.list", "order.create",
+        "cart.add_item", "session.refresh", "inventory.reserve"
+    };
+    static const char * const fields[] = {
+        "name", "email", "address", "created_at", "status", "total",
+        "currency", "items"
+    };
+    char token[33], list[128] = "";
+    int i, n = 1 + rand() % 4;
+
+    for (i = 0; i < 32; i++)
+        token[i] = "0123456789abcdef"[rand() % 16];
+    token[32] = '\0';
+    for (i = 0; i < n; i++)
+        sprintf(list + strlen(list), "%s\"%s\"", i ? "," : "",
+            fields[rand() % 8]);
+    return (sprintf((char *)message, "{\"jsonrpc\":\"2.0\",\"id\":%d,"
+        "\"method\":\"%s\",\"params\":{\"user_id\":%d,\"fields\":[%s],"
+        "\"limit\":%d,\"token\":\"%s\"}}", rand() % 100000,
+        methods[rand() % 7], rand() % 10000000, list, 1 + rand() % 100,
+        token));
+}
+
+/**
+ * train - Trains a static table on each sample file and writes the
+ * tables as C source, defining huffman_static_table
+ *
+ * @files: Paths of the samples, the table of id n being trained on the
+ *   n-th one
+ * @nb_files: Number of samples
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int train(char **files, int nb_files)
+{
+    static unsigned char buf[1 << 16];
+    unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+    huffman_code_t codes[HUFFMAN_NB_SYMBOLS];
+    huffman_decoder_t *decoder;
+    size_t freq[HUFFMAN_NB_SYMBOLS], n, i;
+    FILE *sample;
+    int id;
+
+    printf("/*\n * Generated by 26-main.c from samples it writes, do not"
+        " edit:\n *   ./26-main sample text > text.sample\n *   ./26-main"
+        " sample rpc > rpc.sample\n *   ./26-main train text.sample"
+        " rpc.sample > huffman_static_tables.c\n */\n#include"
+        " \"huffman.h\"\n\nstatic const huffman_static_t tables[] = {\n");
+    for (id = 0; id < nb_files; id++)
+    {
+        memset(freq, 0, sizeof(freq));
+        sample = fopen(files[id], "rb");
+        while (sample && (n = fread(buf, 1, sizeof(buf), sample)) > 0)
+            huffman_histogram(buf, n, freq);
+        if (!sample || !huffman_static_train(freq, lengths) ||
+            !huffman_canonical_codes(lengths, HUFFMAN_NB_SYMBOLS, codes) ||
+            !(decoder = huffman_decoder_create(lengths, HUFFMAN_NB_SYMBOLS)))
+            return (0);
+        fclose(sample);
+        printf("\t/* %d: %s */\n\t{\n\t\t{", id, files[id]);
+        for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+            printf("%s%u", i % 12 ? ", " : i ? ",\n\t\t\t" : "\n\t\t\t",
+                lengths[i]);
+        printf("\n\t\t},\n\t\t{");
+        for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+            printf("%s{0x%lx, %u}", i % 4 ? ", " : i ? ",\n\t\t\t" :
+                "\n\t\t\t", codes[i].bits, codes[i].length);
+        printf("\n\t\t},\n\t\t{\n\t\t\t{");
+        for (i = 0; i < 1 << HUFFMAN_TABLE_BITS; i++)
+            printf("%s0x%04x", i % 6 ? ", " : i ? ",\n\t\t\t\t" : "\n\t\t\t\t",
+                (unsigned int)decoder->primary[i]);
+        printf("\n\t\t\t},\n\t\t\tNULL,\n\t\t\t%u\n\t\t}\n\t}%s\n",
+            decoder->max_length, id + 1 < nb_files ? "," : "");
+        huffman_decoder_delete(decoder);
+    }
+    printf("};\n\n/**\n * huffman_static_table - Gets a static table, which"
+        " Huffman blocks can\n * name by id instead of storing code lengths\n"
+        " * @id: Id of the table\n *\n * Return: Pointer to the table, or NULL"
+        " if there is no table with that id\n */\nconst huffman_static_t"
+        " *huffman_static_table(unsigned int id)\n{\n\tif (id >= sizeof(tables)"
+        " / sizeof(tables[0]))\n\t\treturn (NULL);\n\treturn (&tables[id]);"
+        "\n}\n");
+    return (1);
+}
+
+/**
+ * bench - Compresses messages one by one, then decompresses them
+ *
+ * @messages: The messages, one after the other
+ * @lengths: Length of each message
+ * @flags: Options of the block compressor
+ * @table: Static table to encode the messages with, without block
+ *   headers, or NULL to compress them to blocks
+ * @name: Name of the method
+ *
+ * Return: 1 if the messages come back, 0 otherwise
+ */
+int bench(const unsigned char *messages, const size_t *lengths,
+    unsigned int flags, const huffman_static_t *table, const char *name)
+{
+    unsigned char *packed, check[512];
+    size_t *sizes, i, in = 0, out = 0;
+    clock_t start;
+    double compress_time;
+    int ok = 1;
+
+    packed = malloc(NB_MESSAGES * (512 + HUFFMAN_BLOCK_HEADER_SIZE));
+    sizes = malloc(sizeof(*sizes) * NB_MESSAGES);
+    if (!packed || !sizes)
+        return (0);
+    start = clock();
+    for (i = 0; i < NB_MESSAGES; i++)
+    {
+        if (table)
+            sizes[i] = huffman_encode(table->codes, messages + in,
+                lengths[i], packed + out, 512);
+        else
+            sizes[i] = huffman_block_compress(messages + in, lengths[i],
+                flags, NULL, packed + out);
+        in += lengths[i];
+        out += sizes[i];
+    }
+    compress_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (i = in = out = 0; ok && i < NB_MESSAGES; i++)
+    {
+        ok = table ? huffman_decode(&table->decoder, packed + out, sizes[i],
+            check, lengths[i]) : huffman_block_decompress(packed + out,
+            packed + out + HUFFMAN_BLOCK_HEADER_SIZE, NULL, check);
+        ok = ok && !memcmp(messages + in, check, lengths[i]);
+        in += lengths[i];
+        out += sizes[i];
+    }
+    printf("%-24s %7lu bytes (%5.1f%%), compression %4.0f MB/s,"
+        " decompression %4.0f MB/s, %s\n", name, out, 100.0 * out / in,
+        in / compress_time / 1e6, in / ((double)(clock() - start) /
+        CLOCKS_PER_SEC) / 1e6, ok ? "ok" : "FAILED");
+    free(packed);
+    free(sizes);
+    return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * With "sample text" or "sample rpc", writes a sample of English-like
+ * text or of JSON-RPC requests. With "train" and sample files, writes the
+ * static tables trained on them as C source. Otherwise, compresses
+ * requests of about 200 bytes one by one: with codes built for each,
+ * with the smaller of those and the static tables, with each static
+ * table named in the block header, and with the static table of requests
+ * without any header. The text table doesn't fit requests, their blocks
+ * are stored raw.
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int argc, char **argv)
+{
+    unsigned char *buf;
+    size_t *lengths, i, size = 0;
+    int ok;
+
+    if (argc > 2 && !strcmp(argv[1], "train"))
+        return (train(argv + 2, argc - 2) ? EXIT_SUCCESS : EXIT_FAILURE);
+    buf = malloc(SAMPLE_SIZE + NB_MESSAGES * 512);
+    lengths = malloc(sizeof(*lengths) * NB_MESSAGES);
+    if (!buf || !lengths)
+        return (EXIT_FAILURE);
+    srand(argc > 2 ? 1 : 42);
+    if (argc > 2 && !strcmp(argv[1], "sample") && !strcmp(argv[2], "text"))
+        make_text(buf, size = SAMPLE_SIZE);
+    else if (argc > 2 && !strcmp(argv[1], "sample"))
+        while (size < SAMPLE_SIZE)
+            size += make_message(buf + size);
+    if (argc > 2)
+        return (fwrite(buf, 1, size, stdout) == size ? EXIT_SUCCESS :
+            EXIT_FAILURE);
+    for (i = 0; i < NB_MESSAGES; i++)
+        size += lengths[i] = make_message(buf + size);
+    printf("%d requests, %lu bytes\n", NB_MESSAGES, size);
+    ok = bench(buf, lengths, HUFFMAN_FLAG_NO_STATIC, NULL,
+        "codes built per request");
+    ok = bench(buf, lengths, 0, NULL, "built or static table") && ok;
+    ok = bench(buf, lengths, HUFFMAN_FLAG_TABLE(0), NULL,
+        "table 0 (text), raw") && ok;
+    ok = bench(buf, lengths, HUFFMAN_FLAG_TABLE(1), NULL,
+        "static table 1 (rpc)") && ok;
+    ok = bench(buf, lengths, 0, huffman_static_table(1),
+        "table 1, no header") && ok;
+    free(buf);
+    free(lengths);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
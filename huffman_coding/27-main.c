@@ -0,0 +1,247 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "huffman_stream.h"
+
+#define NB_MESSAGES 100000
+#define MESSAGE_MAX 256
+
+/**
+ * make_message - Generates a telemetry record of 50 to 200 bytes
+ *
+ * @message: Buffer receiving the record, of at least MESSAGE_MAX bytes
+ *
+ * Return: Length of the record
+ */
+size_t make_message(unsigned char *message)
+{
+    static const char * const metrics[] = {
+        "cpu.user", "cpu.system", "mem.used", "disk.read_bytes",
+        "net.rx_packets", "http.requests", "http.latency_ms"
+    };
+    static const char * const hosts[] = {
+        "web-01", "web-02", "db-primary", "cache-3", "worker-17"
+    };
+    int length, n = rand() % 4;
+
+    length = sprintf((char *)message, "{\"ts\":%d,\"host\":\"%s\","
+        "\"metric\":\"%s\",\"value\":%d.%02d", 1700000000 + rand() % 86400,
+        hosts[rand() % 5], metrics[rand() % 7], rand() % 10000, rand() % 100);
+    while (n-- > 0)
+        length += sprintf((char *)message + length, ",\"tag%d\":\"%s\"", n,
+            n % 2 ? "eu-west" : "production");
+    message[length++] = '}';
+    message[length++] = '\n';
+    return (length);
+}
+
+/**
+ * decompress - Decompresses what bench compressed
+ *
+ * @packed: Compressed data
+ * @size: Size of @packed
+ * @adaptive: 1 if @packed was written by the adaptive coder, 0 if it is
+ *   made of blocks
+ * @check: Buffer receiving the decompressed data, with a byte to spare
+ *   so that the adaptive decoder goes on to the last flush
+ * @check_size: Size of the decompressed data
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int decompress(const unsigned char *packed, size_t size, int adaptive,
+    unsigned char *check, size_t check_size)
+{
+    huffman_adaptive_t model;
+    bit_reader_t reader;
+    size_t offset, done = 0;
+    int ok = 1;
+
+    if (adaptive)
+    {
+        reader.in = packed;
+        reader.end = packed + size;
+        reader.buf = 0;
+        reader.count = 0;
+        return (huffman_adaptive_init(&model) &&
+            huffman_adaptive_decode(&model, &reader, check,
+            check_size + 1) == check_size && !reader.count);
+    }
+    for (offset = 0; ok && offset < size; offset += HUFFMAN_BLOCK_HEADER_SIZE
+        + load_be32(packed + offset + 5))
+    {
+        ok = huffman_block_decompress(packed + offset,
+            packed + offset + HUFFMAN_BLOCK_HEADER_SIZE, NULL, check + done);
+        done += load_be32(packed + offset + 1);
+    }
+    return (ok && done == check_size);
+}
+
+/**
+ * bench - Compresses records as they come, with blocks of up to
+ * HUFFMAN_BLOCK_SIZE bytes, with a block per record, or with the adaptive
+ * coder flushed after each record, then decompresses them
+ *
+ * @messages: The records, one after the other
+ * @lengths: Length of each record
+ * @mode: 0 for blocks of HUFFMAN_BLOCK_SIZE bytes, 1 for a block per
+ *   record, 2 for the adaptive coder
+ *
+ * Description: A record leaves the compressor once the block holding it
+ * is compressed, so the records after it in its block hold it back
+ *
+ * Return: 1 if the records come back, 0 otherwise
+ */
+int bench(const unsigned char *messages, const size_t *lengths, int mode)
+{
+    static const char * const names[] = {
+        "128 KB blocks", "one block per record", "adaptive, flush per record"
+    };
+    huffman_adaptive_t model;
+    unsigned char *packed, *check;
+    size_t i, first = 0, in = 0, out = 0, start = 0, size, held = 0;
+    clock_t begin, end, total = 0, worst = 0;
+    int ok;
+
+    packed = malloc(NB_MESSAGES * HUFFMAN_ADAPTIVE_BOUND(MESSAGE_MAX));
+    check = malloc(NB_MESSAGES * MESSAGE_MAX);
+    ok = packed && check && huffman_adaptive_init(&model);
+    for (i = 0; ok && i < NB_MESSAGES; i++)
+    {
+        in += lengths[i];
+        if (!mode && i + 1 < NB_MESSAGES &&
+            in + lengths[i + 1] - start <= HUFFMAN_BLOCK_SIZE)
+            continue;
+        begin = clock();
+        size = mode == 2 ? huffman_adaptive_encode(&model, messages + start,
+            in - start, packed + out, HUFFMAN_ADAPTIVE_BOUND(in - start)) :
+            huffman_block_compress(messages + start, in - start, 0, NULL,
+            packed + out);
+        end = clock();
+        total += end - begin;
+        worst = end - begin > worst ? end - begin : worst;
+        held += (i - first) * (i - first + 1) / 2;
+        first = i + 1;
+        start = in;
+        out += size;
+        ok = size != 0;
+    }
+    ok = ok && decompress(packed, out, mode == 2, check, in) &&
+        !memcmp(messages, check, in);
+    printf("%-27s %5.1f%% %10.1f %9.2f %9.0f %s\n", names[mode],
+        100.0 * out / in, (double)held / NB_MESSAGES,
+        1e6 * total / CLOCKS_PER_SEC / NB_MESSAGES,
+        1e6 * worst / CLOCKS_PER_SEC, ok ? "ok" : "FAILED");
+    free(packed);
+    free(check);
+    return (ok);
+}
+
+/**
+ * stream_round_trip - Writes records to a pipe one by one for the
+ * adaptive stream compressor, then feeds its output to the decompressor
+ * through a pipe a few bytes at a time, then feeds it the same stream
+ * cut at its last flush, which it must reject
+ *
+ * @messages: The records, one after the other
+ * @lengths: Length of each record
+ * @size: Total length of the records
+ *
+ * Return: 1 if the records come back, 0 otherwise
+ */
+int stream_round_trip(const unsigned char *messages, const size_t *lengths,
+    size_t size)
+{
+    huffman_adaptive_t model;
+    FILE *packed, *unpacked;
+    unsigned char *buf;
+    size_t i, n = 0, offset = 0;
+    int fds[2], pass, ok = 1, rejected = 0;
+    pid_t pid;
+
+    buf = malloc(NB_MESSAGES * HUFFMAN_ADAPTIVE_BOUND(MESSAGE_MAX));
+    packed = tmpfile();
+    unpacked = tmpfile();
+    for (pass = 0; ok && pass < 3; pass++)
+    {
+        if (!buf || !packed || !unpacked || pipe(fds) || (pid = fork()) == -1)
+            return (0);
+        if (pid == 0)
+        {
+            close(fds[0]);
+            for (i = 0; pass == 0 && i < NB_MESSAGES; offset += lengths[i++])
+                huffman_write_full(fds[1], messages + offset, lengths[i]);
+            for (i = 0; pass == 1 && i < n; i += 7)
+                huffman_write_full(fds[1], buf + i, n - i < 7 ? n - i : 7);
+            if (pass == 2 && huffman_adaptive_init(&model))
+                huffman_write_full(fds[1], buf, HUFFMAN_STREAM_HEADER_SIZE);
+            for (i = 0; pass == 2 && i < NB_MESSAGES; offset += lengths[i++])
+                huffman_write_full(fds[1], buf, huffman_adaptive_encode(
+                    &model, messages + offset, lengths[i], buf,
+                    HUFFMAN_ADAPTIVE_BOUND(MESSAGE_MAX)));
+            _exit(0);
+        }
+        close(fds[1]);
+        if (pass == 2)
+            rejected = !huffman_adaptive_decompress_stream(fds[0],
+                fileno(packed));
+        else
+            ok = pass ? huffman_adaptive_decompress_stream(fds[0],
+                fileno(unpacked)) : huffman_adaptive_compress_stream(fds[0],
+                fileno(packed));
+        close(fds[0]);
+        waitpid(pid, NULL, 0);
+        rewind(packed);
+        n = pass ? n : fread(buf, 1, NB_MESSAGES * HUFFMAN_ADAPTIVE_BOUND(
+            MESSAGE_MAX), packed);
+    }
+    rewind(unpacked);
+    ok = ok && fread(buf, 1, size, unpacked) == size &&
+        !memcmp(messages, buf, size) && fgetc(unpacked) == EOF;
+    printf("Stream through pipes: %lu -> %lu bytes, %s\n", size, n,
+        ok ? "ok" : "FAILED");
+    printf("Stream cut at its last flush: %s\n",
+        rejected ? "rejected" : "ACCEPTED");
+    fclose(packed);
+    fclose(unpacked);
+    free(buf);
+    return (ok && rejected);
+}
+
+/**
+ * main - Entry point
+ *
+ * Compresses telemetry records of 50 to 200 bytes as they come: in
+ * blocks of 128 KB, with a block per record, and with the adaptive coder
+ * flushed after each record. For each, prints the ratio, how many records
+ * come after a record before it leaves the compressor on average, and
+ * the mean and worst time taken to compress before a record leaves.
+ * Then checks the adaptive stream through pipes, whole and cut before its
+ * end.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    unsigned char *messages;
+    size_t *lengths, i, size = 0;
+    int ok, mode;
+
+    messages = malloc(NB_MESSAGES * MESSAGE_MAX);
+    lengths = malloc(sizeof(*lengths) * NB_MESSAGES);
+    if (!messages || !lengths)
+        return (EXIT_FAILURE);
+    srand(42);
+    for (i = 0; i < NB_MESSAGES; i++)
+        size += lengths[i] = make_message(messages + size);
+    printf("%d records, %lu bytes\n%-27s %6s %10s %9s %9s\n", NB_MESSAGES,
+        size, "", "size", "held back", "mean us", "worst us");
+    for (mode = 0, ok = 1; mode < 3; mode++)
+        ok = bench(messages, lengths, mode) && ok;
+    ok = stream_round_trip(messages, lengths, size) && ok;
+    free(messages);
+    free(lengths);
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
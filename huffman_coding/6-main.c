@@ -33,7 +33,7 @@ int nested_print(char *buffer, void *data)
 int main(void)
 {
     heap_t *priority_queue;
-    char data[] = {
+    huffman_symbol_t data[] = {
         'a', 'b', 'c', 'd', 'e', 'f'
     };
     size_t freq[] = {
@@ -22,9 +22,7 @@ int nested_print(char *buffer, void *data)
 
     nested = (binary_tree_node_t *)data;
     symbol = (symbol_t *)nested->data;
-    c = symbol->data;
-    if (c == -1)
-        c = '$';
+    c = symbol->internal ? '$' : (char)symbol->data;
     length = sprintf(buffer, "(%c/%lu)", c, symbol->freq);
     return (length);
 }
@@ -37,7 +35,7 @@ int nested_print(char *buffer, void *data)
 int main(void)
 {
     heap_t *priority_queue;
-    char data[] = {
+    huffman_symbol_t data[] = {
         'a', 'b', 'c', 'd', 'e', 'f'
     };
     size_t freq[] = {
@@ -0,0 +1,84 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "heap.h"
+
+#define NB_ITEMS 200000
+
+/**
+ * int_cmp - Compares two integers
+ *
+ * @p1: First pointer
+ * @p2: Second pointer
+ *
+ * Return: Negative, zero or positive if the first integer is smaller,
+ * equal or greater than the second one
+ */
+int int_cmp(void *p1, void *p2)
+{
+    int n1, n2;
+
+    n1 = *(int *)p1;
+    n2 = *(int *)p2;
+    return ((n1 > n2) - (n1 < n2));
+}
+
+/**
+ * main - Entry point
+ *
+ * Sorts the same random integers through a heap_t and an array_heap_t,
+ * and compares the time taken
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    heap_t *heap;
+    array_heap_t *array_heap;
+    int *array, *prev, *extracted;
+    size_t i, sorted;
+    clock_t start;
+    double tree_time, array_time;
+
+    array = malloc(sizeof(*array) * NB_ITEMS);
+    heap = heap_create(int_cmp);
+    array_heap = array_heap_create(int_cmp);
+    if (!array || !heap || !array_heap)
+    {
+        fprintf(stderr, "Failed to create the heaps\n");
+        return (EXIT_FAILURE);
+    }
+    srand(42);
+    for (i = 0; i < NB_ITEMS; i++)
+        array[i] = rand();
+
+    start = clock();
+    for (i = 0; i < NB_ITEMS; i++)
+        heap_insert(heap, &array[i]);
+    for (i = 0, sorted = 1, prev = NULL; i < NB_ITEMS; i++, prev = extracted)
+    {
+        extracted = heap_extract(heap);
+        sorted = sorted && extracted && (!prev || *prev <= *extracted);
+    }
+    tree_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("heap_t:       %lu items %s in %.3f s\n", (size_t)NB_ITEMS,
+        sorted ? "sorted" : "NOT sorted", tree_time);
+
+    start = clock();
+    for (i = 0; i < NB_ITEMS; i++)
+        array_heap_insert(array_heap, &array[i]);
+    for (i = 0, sorted = 1, prev = NULL; i < NB_ITEMS; i++, prev = extracted)
+    {
+        extracted = array_heap_extract(array_heap);
+        sorted = sorted && extracted && (!prev || *prev <= *extracted);
+    }
+    array_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("array_heap_t: %lu items %s in %.3f s (%.1fx faster)\n",
+        (size_t)NB_ITEMS, sorted ? "sorted" : "NOT sorted", array_time,
+        array_time > 0 ? tree_time / array_time : 0);
+
+    heap_delete(heap, NULL);
+    array_heap_delete(array_heap, NULL);
+    free(array);
+    return (EXIT_SUCCESS);
+}
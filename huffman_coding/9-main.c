@@ -0,0 +1,66 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "heap.h"
+#include "huffman.h"
+
+void binary_tree_print(const binary_tree_node_t *heap, int (*print_data)(char *, void *));
+
+/**
+ * symbol_print - Prints a symbol structure
+ *
+ * @buffer: Buffer to print into
+ * @data: Pointer to a node's data
+ *
+ * Return: Number of bytes written in buffer
+ */
+int symbol_print(char *buffer, void *data)
+{
+    symbol_t *symbol;
+    char c;
+    int length;
+
+    symbol = (symbol_t *)data;
+    c = symbol->internal ? '$' : (char)symbol->data;
+    length = sprintf(buffer, "(%c/%lu)", c, symbol->freq);
+    return (length);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    binary_tree_node_t *root;
+    huffman_code_t codes[HUFFMAN_NB_SYMBOLS];
+    huffman_symbol_t data[] = {
+        'a', 'b', 'c', 'd', 'e', 'f'
+    };
+    size_t freq[] = {
+        6, 11, 12, 13, 16, 36
+    };
+    size_t size = sizeof(data) / sizeof(data[0]);
+    size_t i;
+    unsigned int j;
+
+    root = huffman_tree(data, freq, size);
+    if (!root || !huffman_codes(root, codes, HUFFMAN_NB_SYMBOLS))
+    {
+        fprintf(stderr, "Failed to build Huffman tree\n");
+        return (EXIT_FAILURE);
+    }
+    binary_tree_print(root, symbol_print);
+    printf("\n");
+
+    for (i = 0; i < size; i++)
+    {
+        printf("%c: ", (char)data[i]);
+        for (j = codes[data[i]].length; j > 0; j--)
+            printf("%lu", codes[data[i]].bits >> (j - 1) & 1);
+        printf("\n");
+    }
+
+    free(root);
+    return (EXIT_SUCCESS);
+}
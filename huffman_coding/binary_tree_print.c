@@ -19,13 +19,13 @@
 static int print_t(const binary_tree_node_t *tree, int offset, int depth,
 	char **s, int (*print_data)(char *, void *))
 {
-	char b[6];
+	char b[32];
 	int width, left, right, is_left, i;
 
 	if (!tree)
 		return (0);
 	is_left = (tree->parent && tree->parent->left == tree);
-	width = print_data(b, tree->data) + 1;
+	width = print_data(b, tree->data);
 	left = print_t(tree->left, offset, depth + 1, s, print_data);
 	right = print_t(tree->right, offset + left + width, depth + 1, s, print_data);
 	for (i = 0; i < width; i++)
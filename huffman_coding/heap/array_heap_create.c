@@ -0,0 +1,105 @@
+#include "heap.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ARRAY_HEAP_MIN_CAPACITY 16
+
+/**
+ * array_heap_resize - Moves the items of a heap stored in an array to a
+ * new array
+ * @heap: Pointer to the heap, its items can be NULL
+ * @capacity: Number of items the new array holds, at least the size of
+ *   the heap
+ *
+ * Description: The array is aligned on ARRAY_HEAP_ALIGNMENT bytes, which
+ * realloc doesn't do, so the items are copied
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int array_heap_resize(array_heap_t *heap, size_t capacity)
+{
+	void *block;
+
+	if (posix_memalign(&block, ARRAY_HEAP_ALIGNMENT,
+		sizeof(void *) * (capacity + heap->arity - 1)))
+		return (0);
+	if (heap->items)
+	{
+		memcpy((void **)block + heap->arity - 1, heap->items,
+			sizeof(void *) * heap->size);
+		free(heap->items - (heap->arity - 1));
+	}
+	heap->items = (void **)block + heap->arity - 1;
+	heap->capacity = capacity;
+	return (1);
+}
+
+/**
+ * array_heap_init - Initializes a d-ary heap stored in a contiguous array,
+ * in memory owned by the caller
+ * @heap: Pointer to the heap to initialize
+ * @data_cmp: Pointer to a comparison function
+ * @arity: Number of children of each item, as for array_heap_create_ex
+ *
+ * Description: This lets a heap be embedded in a larger structure, such
+ * as the cache line of a MultiQueue heap. array_heap_clear gives its
+ * array back.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int array_heap_init(array_heap_t *heap, int (*data_cmp)(void *, void *),
+		unsigned int arity)
+{
+	if (heap == NULL || data_cmp == NULL || arity < 2 ||
+		arity & (arity - 1) ||
+		arity > ARRAY_HEAP_ALIGNMENT / sizeof(void *))
+		return (0);
+
+	heap->size = 0;
+	heap->data_cmp = data_cmp;
+	heap->items = NULL;
+	heap->arity = arity;
+	for (heap->shift = 0; 1U << heap->shift < arity; heap->shift++)
+		;
+	return (array_heap_resize(heap, ARRAY_HEAP_MIN_CAPACITY));
+}
+
+/**
+ * array_heap_create_ex - Creates a d-ary heap stored in a contiguous
+ * array
+ * @data_cmp: Pointer to a comparison function
+ * @arity: Number of children of each item, a power of 2 from 2 to
+ *   ARRAY_HEAP_ALIGNMENT / sizeof(void *). A sift-down takes
+ *   log(n) / log(@arity) levels, each touching one cache line, at the
+ *   cost of more comparisons per level.
+ *
+ * Return: Pointer to the created heap, or NULL on failure
+ */
+array_heap_t *array_heap_create_ex(int (*data_cmp)(void *, void *),
+		unsigned int arity)
+{
+	array_heap_t *heap;
+
+	heap = malloc(sizeof(array_heap_t));
+	if (heap == NULL)
+		return (NULL);
+
+	if (!array_heap_init(heap, data_cmp, arity))
+	{
+		free(heap);
+		return (NULL);
+	}
+
+	return (heap);
+}
+
+/**
+ * array_heap_create - Creates a binary heap stored in a contiguous array
+ * @data_cmp: Pointer to a comparison function
+ *
+ * Return: Pointer to the created heap, or NULL on failure
+ */
+array_heap_t *array_heap_create(int (*data_cmp)(void *, void *))
+{
+	return (array_heap_create_ex(data_cmp, 2));
+}
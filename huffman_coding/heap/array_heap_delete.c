@@ -0,0 +1,34 @@
+#include "heap.h"
+#include <stdlib.h>
+
+/**
+ * array_heap_clear - Deallocates the array of a heap initialized by
+ * array_heap_init, but not the heap itself
+ * @heap: Pointer to the heap to clear
+ * @free_data: Function to free the data of each item (can be NULL)
+ */
+void array_heap_clear(array_heap_t *heap, void (*free_data)(void *))
+{
+	size_t i;
+
+	if (heap == NULL)
+		return;
+
+	if (free_data != NULL)
+		for (i = 0; i < heap->size; i++)
+			free_data(heap->items[i]);
+	free(heap->items - (heap->arity - 1));
+	heap->items = NULL;
+	heap->size = 0;
+}
+
+/**
+ * array_heap_delete - Deallocates a heap stored in an array
+ * @heap: Pointer to the heap to delete
+ * @free_data: Function to free the data of each item (can be NULL)
+ */
+void array_heap_delete(array_heap_t *heap, void (*free_data)(void *))
+{
+	array_heap_clear(heap, free_data);
+	free(heap);
+}
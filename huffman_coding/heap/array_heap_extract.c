@@ -0,0 +1,41 @@
+#include "heap.h"
+#include <stdlib.h>
+
+/**
+ * array_heap_extract - Extracts the root value of a Min Binary Heap
+ * stored in an array
+ * @heap: Pointer to the heap
+ *
+ * Description: The last item is sifted down from the root, the smallest
+ * child moving up into the hole at each level
+ *
+ * Return: Pointer to the data that was stored in the root, or NULL if
+ * the heap is empty
+ */
+void *array_heap_extract(array_heap_t *heap)
+{
+	void *data, *last, **items;
+	size_t hole, child, first, end;
+
+	if (!heap || !heap->size)
+		return (NULL);
+
+	items = heap->items;
+	data = items[0];
+	last = items[--heap->size];
+	for (hole = 0; (first = (hole << heap->shift) + 1) < heap->size;
+		hole = child)
+	{
+		end = first + heap->arity < heap->size ? first + heap->arity :
+			heap->size;
+		for (child = first++; first < end; first++)
+			if (heap->data_cmp(items[first], items[child]) < 0)
+				child = first;
+		if (heap->data_cmp(items[child], last) >= 0)
+			break;
+		items[hole] = items[child];
+	}
+	items[hole] = last;
+
+	return (data);
+}
@@ -0,0 +1,37 @@
+#include "heap.h"
+#include <stdlib.h>
+
+/**
+ * array_heap_insert - Inserts a value in a Min Binary Heap stored in an
+ * array
+ * @heap: Pointer to the heap
+ * @data: Pointer to the data to store
+ *
+ * Description: The array doubles when it is full. The new item is sifted
+ * up by moving its ancestors down into the hole, and it is only written
+ * once at its final position.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int array_heap_insert(array_heap_t *heap, void *data)
+{
+	size_t hole, parent;
+
+	if (!heap || !data)
+		return (0);
+
+	if (heap->size == heap->capacity &&
+		!array_heap_resize(heap, heap->capacity * 2))
+		return (0);
+
+	for (hole = heap->size++; hole > 0; hole = parent)
+	{
+		parent = (hole - 1) >> heap->shift;
+		if (heap->data_cmp(data, heap->items[parent]) >= 0)
+			break;
+		heap->items[hole] = heap->items[parent];
+	}
+	heap->items[hole] = data;
+
+	return (1);
+}
@@ -33,11 +33,89 @@ typedef struct heap_s
 	binary_tree_node_t *root;
 } heap_t;
 
+/**
+ * struct array_heap_s - Heap stored in a contiguous array
+ *
+ * @size: Number of items in the heap
+ * @capacity: Number of items the array can hold before it grows
+ * @data_cmp: Function to compare two items
+ * @items: Array of the items, the children of the item at index i
+ *   being at indexes @arity * i + 1 to @arity * i + @arity
+ * @arity: Number of children of each item, a power of 2
+ * @shift: Base 2 logarithm of @arity, so that finding a parent or a
+ *   child takes a shift rather than a division
+ *
+ * The array is allocated ARRAY_HEAP_ALIGNMENT bytes aligned, @arity - 1
+ * slots before @items, so that the children of an item start at a
+ * multiple of @arity slots: with pointers of 8 bytes, the 8 children of
+ * an 8-ary heap fill exactly one 64-byte cache line.
+ */
+typedef struct array_heap_s
+{
+	size_t size;
+	size_t capacity;
+	int (*data_cmp)(void *, void *);
+	void **items;
+	unsigned int arity;
+	unsigned int shift;
+} array_heap_t;
+
+#define ARRAY_HEAP_ALIGNMENT 64
+
+/**
+ * struct indexed_heap_s - Heap stored in an array, whose items are known
+ * by a handle, so that they can be found, moved or removed
+ *
+ * @size: Number of items in the heap
+ * @nb_handles: Number of handles, handles going from 0 to @nb_handles - 1
+ * @data_cmp: Function to compare two items
+ * @items: Array of the items, as in an array_heap_t
+ * @handles: Handle of the item at each position of @items
+ * @positions: Position in @items of the item of each handle,
+ *   INDEXED_HEAP_ABSENT if the handle has no item in the heap
+ */
+typedef struct indexed_heap_s
+{
+	size_t size;
+	size_t nb_handles;
+	int (*data_cmp)(void *, void *);
+	void **items;
+	size_t *handles;
+	size_t *positions;
+} indexed_heap_t;
+
+#define INDEXED_HEAP_ABSENT ((size_t)-1)
+
 /* Function prototype */
 void *heap_extract(heap_t *heap);
 void heap_delete(heap_t *heap, void (*free_data)(void *));
 heap_t *heap_create(int (*data_cmp)(void *, void *));
+heap_t *heap_create_from_array(int (*data_cmp)(void *, void *), void **items,
+	size_t n);
+void heapify_down(heap_t *heap, binary_tree_node_t *node);
 binary_tree_node_t *heap_insert(heap_t *heap, void *data);
 binary_tree_node_t *binary_tree_node(binary_tree_node_t *parent, void *data);
+int array_heap_init(array_heap_t *heap, int (*data_cmp)(void *, void *),
+	unsigned int arity);
+array_heap_t *array_heap_create(int (*data_cmp)(void *, void *));
+array_heap_t *array_heap_create_ex(int (*data_cmp)(void *, void *),
+	unsigned int arity);
+int array_heap_resize(array_heap_t *heap, size_t capacity);
+int array_heap_insert(array_heap_t *heap, void *data);
+void *array_heap_extract(array_heap_t *heap);
+void array_heap_clear(array_heap_t *heap, void (*free_data)(void *));
+void array_heap_delete(array_heap_t *heap, void (*free_data)(void *));
+indexed_heap_t *indexed_heap_create(int (*data_cmp)(void *, void *),
+	size_t nb_handles);
+void indexed_heap_delete(indexed_heap_t *heap, void (*free_data)(void *));
+void indexed_heap_sift_up(indexed_heap_t *heap, size_t hole, void *data,
+	size_t handle);
+void indexed_heap_sift_down(indexed_heap_t *heap, size_t hole, void *data,
+	size_t handle);
+int indexed_heap_insert(indexed_heap_t *heap, size_t handle, void *data);
+void *indexed_heap_extract(indexed_heap_t *heap, size_t *handle);
+int indexed_heap_decrease_key(indexed_heap_t *heap, size_t handle,
+	void *data);
+void *indexed_heap_remove(indexed_heap_t *heap, size_t handle);
 
 #endif /* HEAP_H */
@@ -0,0 +1,72 @@
+#include <stdlib.h>
+#include "heap.h"
+
+/**
+ * link_nodes - Creates the nodes of a heap in level order
+ * @nodes: Receives the nodes, node i being the parent of nodes 2i + 1
+ *   and 2i + 2
+ * @items: Data of the nodes
+ * @n: Number of nodes
+ *
+ * Return: Number of nodes created, less than @n on failure
+ */
+static size_t link_nodes(binary_tree_node_t **nodes, void **items, size_t n)
+{
+	binary_tree_node_t *parent;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (!items[i])
+			break;
+		parent = i ? nodes[(i - 1) / 2] : NULL;
+		nodes[i] = binary_tree_node(parent, items[i]);
+		if (!nodes[i])
+			break;
+		if (parent && i % 2)
+			parent->left = nodes[i];
+		else if (parent)
+			parent->right = nodes[i];
+	}
+	return (i);
+}
+
+/**
+ * heap_create_from_array - Creates a Min Binary Heap holding an array of
+ * data
+ * @data_cmp: Pointer to a comparison function
+ * @items: Data to store, none of them NULL
+ * @n: Number of items
+ *
+ * Description: The items are laid out in the tree as they are in the
+ * array, then the heap property is restored bottom-up, sifting down each
+ * parent from the last one to the root (Floyd's method). That takes O(n)
+ * comparisons, where n inserts take O(n log n).
+ *
+ * Return: Pointer to the created heap, or NULL on failure
+ */
+heap_t *heap_create_from_array(int (*data_cmp)(void *, void *), void **items,
+		size_t n)
+{
+	binary_tree_node_t **nodes;
+	heap_t *heap;
+	size_t i, created;
+
+	heap = heap_create(data_cmp);
+	if (!heap || !n)
+		return (heap);
+	nodes = items ? malloc(sizeof(*nodes) * n) : NULL;
+	created = nodes ? link_nodes(nodes, items, n) : 0;
+	heap->root = created ? nodes[0] : NULL;
+	if (created < n)
+	{
+		free(nodes);
+		heap_delete(heap, NULL);
+		return (NULL);
+	}
+	for (i = n / 2; i-- > 0;)
+		heapify_down(heap, nodes[i]);
+	heap->size = n;
+	free(nodes);
+	return (heap);
+}
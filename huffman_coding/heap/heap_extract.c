@@ -39,40 +39,6 @@ binary_tree_node_t *get_last_node(heap_t *heap)
 	return (node);
 }
 
-/**
- * find_parent - Finds the parent of a node
- * @root: Root of the tree
- * @node: Node to find parent of
- * Return: Pointer to parent node, or NULL if node is root
- */
-binary_tree_node_t *find_parent(binary_tree_node_t *root,
-		binary_tree_node_t *node)
-{
-	binary_tree_node_t *parent = NULL;
-
-	if (!root || root == node)
-		return (NULL);
-
-	if (root->left == node || root->right == node)
-		return (root);
-
-	if (root->left)
-	{
-		parent = find_parent(root->left, node);
-		if (parent)
-			return (parent);
-	}
-
-	if (root->right)
-	{
-		parent = find_parent(root->right, node);
-		if (parent)
-			return (parent);
-	}
-
-	return (NULL);
-}
-
 /**
  * heapify_down - Restores the min heap property by moving a node down
  * @heap: Pointer to the heap
@@ -110,7 +76,8 @@ int remove_last_node(heap_t *heap, binary_tree_node_t *last)
 {
 	binary_tree_node_t *parent;
 
-	parent = find_parent(heap->root, last);
+	/* The parent link makes this O(1), no need to search the tree */
+	parent = last->parent;
 	if (!parent && last != heap->root)
 		return (0);
 
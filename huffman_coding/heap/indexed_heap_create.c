@@ -0,0 +1,58 @@
+#include "heap.h"
+#include <stdlib.h>
+
+/**
+ * indexed_heap_create - Creates a heap whose items are known by a handle
+ * @data_cmp: Pointer to a comparison function
+ * @nb_handles: Number of handles, such as the number of vertices of a
+ *   graph; the heap never holds more items than that
+ *
+ * Description: The heap and its arrays are allocated at once, the heap
+ * never grows
+ *
+ * Return: Pointer to the created heap, or NULL on failure
+ */
+indexed_heap_t *indexed_heap_create(int (*data_cmp)(void *, void *),
+		size_t nb_handles)
+{
+	indexed_heap_t *heap;
+	size_t i;
+
+	if (data_cmp == NULL)
+		return (NULL);
+
+	heap = malloc(sizeof(*heap) + (sizeof(void *) + sizeof(size_t) * 2) *
+		nb_handles);
+	if (heap == NULL)
+		return (NULL);
+
+	heap->size = 0;
+	heap->nb_handles = nb_handles;
+	heap->data_cmp = data_cmp;
+	heap->items = (void **)(heap + 1);
+	heap->handles = (size_t *)(heap->items + nb_handles);
+	heap->positions = heap->handles + nb_handles;
+	for (i = 0; i < nb_handles; i++)
+		heap->positions[i] = INDEXED_HEAP_ABSENT;
+
+	return (heap);
+}
+
+/**
+ * indexed_heap_delete - Deallocates a heap whose items are known by a
+ * handle
+ * @heap: Pointer to the heap to delete
+ * @free_data: Function to free the data of each item (can be NULL)
+ */
+void indexed_heap_delete(indexed_heap_t *heap, void (*free_data)(void *))
+{
+	size_t i;
+
+	if (heap == NULL)
+		return;
+
+	if (free_data != NULL)
+		for (i = 0; i < heap->size; i++)
+			free_data(heap->items[i]);
+	free(heap);
+}
@@ -0,0 +1,26 @@
+#include "heap.h"
+
+/**
+ * indexed_heap_extract - Extracts the smallest item of a heap
+ * @heap: Pointer to the heap
+ * @handle: Receives the handle of the item, can be NULL
+ *
+ * Return: Pointer to the data of the item, or NULL if the heap is empty
+ */
+void *indexed_heap_extract(indexed_heap_t *heap, size_t *handle)
+{
+	void *data;
+
+	if (!heap || !heap->size)
+		return (NULL);
+
+	data = heap->items[0];
+	if (handle)
+		*handle = heap->handles[0];
+	heap->positions[heap->handles[0]] = INDEXED_HEAP_ABSENT;
+	if (--heap->size)
+		indexed_heap_sift_down(heap, 0, heap->items[heap->size],
+			heap->handles[heap->size]);
+
+	return (data);
+}
@@ -0,0 +1,20 @@
+#include "heap.h"
+
+/**
+ * indexed_heap_insert - Inserts an item in a heap under a handle
+ * @heap: Pointer to the heap
+ * @handle: Handle of the item, less than the number of handles
+ * @data: Pointer to the data to store
+ *
+ * Return: 1 on success, 0 on failure or if @handle already has an item
+ * in the heap
+ */
+int indexed_heap_insert(indexed_heap_t *heap, size_t handle, void *data)
+{
+	if (!heap || !data || handle >= heap->nb_handles ||
+		heap->positions[handle] != INDEXED_HEAP_ABSENT)
+		return (0);
+
+	indexed_heap_sift_up(heap, heap->size++, data, handle);
+	return (1);
+}
@@ -0,0 +1,63 @@
+#include "heap.h"
+
+/**
+ * indexed_heap_sift_up - Moves an item up from a hole of a heap to its
+ * place
+ * @heap: Pointer to the heap
+ * @hole: Position the item starts from, whose contents are ignored
+ * @data: The item
+ * @handle: Handle of the item
+ *
+ * Description: Ancestors are moved down into the hole, the item is only
+ * written once at its final position. Each move updates the position of
+ * the item moved.
+ */
+void indexed_heap_sift_up(indexed_heap_t *heap, size_t hole, void *data,
+		size_t handle)
+{
+	size_t parent;
+
+	for (; hole > 0; hole = parent)
+	{
+		parent = (hole - 1) / 2;
+		if (heap->data_cmp(data, heap->items[parent]) >= 0)
+			break;
+		heap->items[hole] = heap->items[parent];
+		heap->handles[hole] = heap->handles[parent];
+		heap->positions[heap->handles[hole]] = hole;
+	}
+	heap->items[hole] = data;
+	heap->handles[hole] = handle;
+	heap->positions[handle] = hole;
+}
+
+/**
+ * indexed_heap_sift_down - Moves an item down from a hole of a heap to
+ * its place
+ * @heap: Pointer to the heap
+ * @hole: Position the item starts from, whose contents are ignored
+ * @data: The item
+ * @handle: Handle of the item
+ *
+ * Description: The smallest child moves up into the hole at each level
+ */
+void indexed_heap_sift_down(indexed_heap_t *heap, size_t hole, void *data,
+		size_t handle)
+{
+	size_t child;
+
+	for (; (child = hole * 2 + 1) < heap->size; hole = child)
+	{
+		if (child + 1 < heap->size && heap->data_cmp(
+			heap->items[child + 1], heap->items[child]) < 0)
+			child++;
+		if (heap->data_cmp(heap->items[child], data) >= 0)
+			break;
+		heap->items[hole] = heap->items[child];
+		heap->handles[hole] = heap->handles[child];
+		heap->positions[heap->handles[hole]] = hole;
+	}
+	heap->items[hole] = data;
+	heap->handles[hole] = handle;
+	heap->positions[handle] = hole;
+}
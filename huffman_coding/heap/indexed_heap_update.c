@@ -0,0 +1,56 @@
+#include "heap.h"
+
+/**
+ * indexed_heap_decrease_key - Gives an item of a heap a smaller key
+ * @heap: Pointer to the heap
+ * @handle: Handle of the item
+ * @data: New data of the item, not greater than the current one; it can
+ *   be the same pointer, once the key it points to was lowered
+ *
+ * Return: 1 on success, 0 if @handle has no item in the heap
+ */
+int indexed_heap_decrease_key(indexed_heap_t *heap, size_t handle,
+		void *data)
+{
+	if (!heap || !data || handle >= heap->nb_handles ||
+		heap->positions[handle] == INDEXED_HEAP_ABSENT)
+		return (0);
+
+	indexed_heap_sift_up(heap, heap->positions[handle], data, handle);
+	return (1);
+}
+
+/**
+ * indexed_heap_remove - Removes an item from a heap, wherever it is
+ * @heap: Pointer to the heap
+ * @handle: Handle of the item
+ *
+ * Description: The last item takes the place of the removed one, and
+ * moves up or down from there, whichever restores the heap property
+ *
+ * Return: Pointer to the data of the removed item, or NULL if @handle
+ * has no item in the heap
+ */
+void *indexed_heap_remove(indexed_heap_t *heap, size_t handle)
+{
+	size_t hole, last_handle;
+	void *data, *last;
+
+	if (!heap || handle >= heap->nb_handles ||
+		heap->positions[handle] == INDEXED_HEAP_ABSENT)
+		return (NULL);
+
+	hole = heap->positions[handle];
+	data = heap->items[hole];
+	heap->positions[handle] = INDEXED_HEAP_ABSENT;
+	last = heap->items[--heap->size];
+	last_handle = heap->handles[heap->size];
+	if (hole == heap->size)
+		return (data);
+	if (hole > 0 && heap->data_cmp(last, heap->items[(hole - 1) / 2]) < 0)
+		indexed_heap_sift_up(heap, hole, last, last_handle);
+	else
+		indexed_heap_sift_down(heap, hole, last, last_handle);
+
+	return (data);
+}
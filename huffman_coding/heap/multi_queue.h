@@ -0,0 +1,52 @@
+#ifndef MULTI_QUEUE_H
+#define MULTI_QUEUE_H
+
+#include <pthread.h>
+#include "heap.h"
+
+/* Attempts at locking random heaps before waiting for a lock */
+#define MULTI_QUEUE_MAX_TRIES 8
+
+/**
+ * struct multi_queue_heap_s - One heap of a MultiQueue
+ *
+ * @lock: Protects @heap
+ * @heap: The heap, whose header is embedded with its lock
+ *
+ * Each one is allocated alone in whole ARRAY_HEAP_ALIGNMENT bytes blocks,
+ * header included, so that threads working on neighbour heaps don't
+ * share a cache line.
+ */
+typedef struct multi_queue_heap_s
+{
+	pthread_mutex_t lock;
+	array_heap_t heap;
+} multi_queue_heap_t;
+
+/**
+ * struct multi_queue_s - Relaxed concurrent priority queue
+ *
+ * @nb_heaps: Number of heaps
+ * @heaps: The heaps, each one with its own lock
+ *
+ * An item is pushed into a random heap, and popped from the better of
+ * two random heaps, so threads rarely wait for each other if there are a
+ * few heaps per thread. The item popped is not always the smallest one:
+ * as the best of two choices keeps the heaps balanced, the number of
+ * items smaller than it is O(@nb_heaps) on average, with an exponential
+ * tail. 23-main.c measures it.
+ */
+typedef struct multi_queue_s
+{
+	size_t nb_heaps;
+	multi_queue_heap_t **heaps;
+} multi_queue_t;
+
+/* Function prototype */
+multi_queue_t *multi_queue_create(int (*data_cmp)(void *, void *),
+	size_t nb_heaps);
+void multi_queue_delete(multi_queue_t *queue, void (*free_data)(void *));
+int multi_queue_push(multi_queue_t *queue, void *data, unsigned int *seed);
+void *multi_queue_pop(multi_queue_t *queue, unsigned int *seed);
+
+#endif /* MULTI_QUEUE_H */
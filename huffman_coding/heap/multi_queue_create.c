@@ -0,0 +1,71 @@
+#include "multi_queue.h"
+#include <stdlib.h>
+
+/**
+ * multi_queue_create - Creates a relaxed concurrent priority queue
+ * @data_cmp: Pointer to a comparison function
+ * @nb_heaps: Number of heaps, typically 2 to 4 per thread using the
+ *   queue. More heaps mean less waiting but a larger rank error.
+ *
+ * Return: Pointer to the created queue, or NULL on failure
+ */
+multi_queue_t *multi_queue_create(int (*data_cmp)(void *, void *),
+		size_t nb_heaps)
+{
+	multi_queue_t *queue;
+	multi_queue_heap_t *heap;
+	void *block;
+	size_t size;
+
+	if (data_cmp == NULL || nb_heaps == 0)
+		return (NULL);
+
+	queue = malloc(sizeof(*queue) + sizeof(*queue->heaps) * nb_heaps);
+	if (queue == NULL)
+		return (NULL);
+
+	queue->heaps = (multi_queue_heap_t **)(queue + 1);
+	size = (sizeof(*heap) + ARRAY_HEAP_ALIGNMENT - 1) /
+		ARRAY_HEAP_ALIGNMENT * ARRAY_HEAP_ALIGNMENT;
+	for (queue->nb_heaps = 0; queue->nb_heaps < nb_heaps; queue->nb_heaps++)
+	{
+		if (posix_memalign(&block, ARRAY_HEAP_ALIGNMENT, size))
+			break;
+		heap = block;
+		if (!array_heap_init(&heap->heap, data_cmp, 2))
+		{
+			free(heap);
+			break;
+		}
+		pthread_mutex_init(&heap->lock, NULL);
+		queue->heaps[queue->nb_heaps] = heap;
+	}
+	if (queue->nb_heaps < nb_heaps)
+	{
+		multi_queue_delete(queue, NULL);
+		return (NULL);
+	}
+
+	return (queue);
+}
+
+/**
+ * multi_queue_delete - Deallocates a relaxed concurrent priority queue
+ * @queue: Pointer to the queue to delete, no thread using it anymore
+ * @free_data: Function to free the data of each item (can be NULL)
+ */
+void multi_queue_delete(multi_queue_t *queue, void (*free_data)(void *))
+{
+	size_t i;
+
+	if (queue == NULL)
+		return;
+
+	for (i = 0; i < queue->nb_heaps; i++)
+	{
+		array_heap_clear(&queue->heaps[i]->heap, free_data);
+		pthread_mutex_destroy(&queue->heaps[i]->lock);
+		free(queue->heaps[i]);
+	}
+	free(queue);
+}
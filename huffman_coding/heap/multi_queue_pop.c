@@ -0,0 +1,73 @@
+#include "multi_queue.h"
+#include <stdlib.h>
+
+/**
+ * pop_best_of_two - Pops the smaller of the tops of two random heaps of a
+ * MultiQueue
+ * @queue: Pointer to the queue, of 2 heaps or more
+ * @seed: Random state of the calling thread
+ * @data: Receives the item popped, NULL if both heaps were empty
+ *
+ * Description: The heaps are only tried, so that two threads locking the
+ * same pair in opposite orders never wait for each other
+ *
+ * Return: 1 if two heaps could be locked, 0 otherwise
+ */
+static int pop_best_of_two(multi_queue_t *queue, unsigned int *seed,
+		void **data)
+{
+	multi_queue_heap_t *first, *second, *best;
+
+	first = queue->heaps[rand_r(seed) % queue->nb_heaps];
+	second = queue->heaps[rand_r(seed) % queue->nb_heaps];
+	if (first == second || pthread_mutex_trylock(&first->lock))
+		return (0);
+	if (pthread_mutex_trylock(&second->lock))
+	{
+		pthread_mutex_unlock(&first->lock);
+		return (0);
+	}
+	best = !second->heap.size ? first : !first->heap.size ? second :
+		first->heap.data_cmp(first->heap.items[0],
+		second->heap.items[0]) <= 0 ? first : second;
+	*data = array_heap_extract(&best->heap);
+	pthread_mutex_unlock(&second->lock);
+	pthread_mutex_unlock(&first->lock);
+	return (1);
+}
+
+/**
+ * multi_queue_pop - Extracts a small value from a MultiQueue
+ * @queue: Pointer to the queue
+ * @seed: Random state of the calling thread, as for rand_r
+ *
+ * Description: The item is the smaller of the tops of two random heaps.
+ * If both are empty, or pairs of heaps couldn't be locked
+ * MULTI_QUEUE_MAX_TRIES times, every heap is visited in turn from a
+ * random one, so that NULL is only returned if the queue looked empty.
+ *
+ * Return: Pointer to the data popped, or NULL if the queue is empty
+ */
+void *multi_queue_pop(multi_queue_t *queue, unsigned int *seed)
+{
+	multi_queue_heap_t *heap;
+	void *data = NULL;
+	size_t tries, start, i;
+
+	if (!queue || !seed)
+		return (NULL);
+
+	for (tries = 0; queue->nb_heaps > 1 && tries < MULTI_QUEUE_MAX_TRIES;
+		tries++)
+		if (pop_best_of_two(queue, seed, &data))
+			break;
+	start = rand_r(seed) % queue->nb_heaps;
+	for (i = 0; !data && i < queue->nb_heaps; i++)
+	{
+		heap = queue->heaps[(start + i) % queue->nb_heaps];
+		pthread_mutex_lock(&heap->lock);
+		data = array_heap_extract(&heap->heap);
+		pthread_mutex_unlock(&heap->lock);
+	}
+	return (data);
+}
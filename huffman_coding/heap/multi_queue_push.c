@@ -0,0 +1,52 @@
+#include "multi_queue.h"
+#include <stdlib.h>
+
+/**
+ * lock_random - Locks a random heap of a MultiQueue
+ * @queue: Pointer to the queue
+ * @seed: Random state of the calling thread
+ *
+ * Description: Heaps held by other threads are skipped, until
+ * MULTI_QUEUE_MAX_TRIES of them were: then the thread waits for the last
+ * one, rather than spinning while its holder is descheduled
+ *
+ * Return: Pointer to the locked heap
+ */
+static multi_queue_heap_t *lock_random(multi_queue_t *queue,
+		unsigned int *seed)
+{
+	multi_queue_heap_t *heap;
+	size_t tries;
+
+	for (tries = 0; ; tries++)
+	{
+		heap = queue->heaps[rand_r(seed) % queue->nb_heaps];
+		if (tries == MULTI_QUEUE_MAX_TRIES)
+			pthread_mutex_lock(&heap->lock);
+		else if (pthread_mutex_trylock(&heap->lock))
+			continue;
+		return (heap);
+	}
+}
+
+/**
+ * multi_queue_push - Inserts a value in a MultiQueue
+ * @queue: Pointer to the queue
+ * @data: Pointer to the data to store
+ * @seed: Random state of the calling thread, as for rand_r
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int multi_queue_push(multi_queue_t *queue, void *data, unsigned int *seed)
+{
+	multi_queue_heap_t *heap;
+	int ok;
+
+	if (!queue || !data || !seed)
+		return (0);
+
+	heap = lock_random(queue, seed);
+	ok = array_heap_insert(&heap->heap, data);
+	pthread_mutex_unlock(&heap->lock);
+	return (ok);
+}
@@ -0,0 +1,64 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <stddef.h>
+
+/* One bucket for the keys equal to the last one, one per bit for others */
+#define RADIX_HEAP_NB_BUCKETS (sizeof(size_t) * 8 + 1)
+
+/**
+ * struct radix_heap_item_s - Item of a radix heap
+ *
+ * @key: Priority of the item
+ * @data: Data stored with the key
+ */
+typedef struct radix_heap_item_s
+{
+	size_t key;
+	void *data;
+} radix_heap_item_t;
+
+/**
+ * struct radix_heap_bucket_s - Unordered array of the items of a radix
+ * heap whose keys share a prefix with the last key extracted
+ *
+ * @size: Number of items in the bucket
+ * @capacity: Number of items the array can hold before it grows
+ * @items: Array of the items
+ */
+typedef struct radix_heap_bucket_s
+{
+	size_t size;
+	size_t capacity;
+	radix_heap_item_t *items;
+} radix_heap_bucket_t;
+
+/**
+ * struct radix_heap_s - Monotone priority queue on integer keys
+ *
+ * @size: Number of items in the heap
+ * @last: Last key extracted, no key below it can be inserted
+ * @buckets: Bucket 0 holds the keys equal to @last, bucket i > 0 the keys
+ *   whose highest bit differing from @last is bit i - 1
+ *
+ * Keys are compared by their bits, no comparison function is called. An
+ * item moves to a lower bucket each time it is touched after an
+ * extraction, so it moves at most once per bit of a key.
+ */
+typedef struct radix_heap_s
+{
+	size_t size;
+	size_t last;
+	radix_heap_bucket_t buckets[RADIX_HEAP_NB_BUCKETS];
+} radix_heap_t;
+
+/* Function prototype */
+radix_heap_t *radix_heap_create(void);
+void radix_heap_delete(radix_heap_t *heap, void (*free_data)(void *));
+int radix_heap_insert(radix_heap_t *heap, size_t key, void *data);
+void *radix_heap_extract(radix_heap_t *heap, size_t *key);
+size_t radix_heap_bucket_index(size_t key, size_t last);
+int radix_heap_bucket_push(radix_heap_bucket_t *bucket, size_t key,
+	void *data);
+
+#endif /* RADIX_HEAP_H */
@@ -0,0 +1,57 @@
+#include "radix_heap.h"
+#include <stdlib.h>
+
+#define RADIX_HEAP_MIN_CAPACITY 16
+
+/**
+ * radix_heap_bucket_index - Finds the bucket of a key
+ * @key: The key
+ * @last: Last key extracted from the heap, not greater than @key
+ *
+ * Return: 0 if @key equals @last, 1 + the index of the highest bit they
+ * differ by otherwise
+ */
+size_t radix_heap_bucket_index(size_t key, size_t last)
+{
+	size_t diff = key ^ last, index = 0, step;
+
+	if (!diff)
+		return (0);
+	for (step = sizeof(size_t) * 4; step > 0; step >>= 1)
+		if (diff >> step)
+		{
+			diff >>= step;
+			index += step;
+		}
+	return (index + 1);
+}
+
+/**
+ * radix_heap_bucket_push - Adds an item to a bucket, growing it if it is
+ * full
+ * @bucket: Pointer to the bucket
+ * @key: Key of the item
+ * @data: Data of the item
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int radix_heap_bucket_push(radix_heap_bucket_t *bucket, size_t key,
+		void *data)
+{
+	radix_heap_item_t *items;
+	size_t capacity;
+
+	if (bucket->size == bucket->capacity)
+	{
+		capacity = bucket->capacity ? bucket->capacity * 2 :
+			RADIX_HEAP_MIN_CAPACITY;
+		items = realloc(bucket->items, sizeof(*items) * capacity);
+		if (items == NULL)
+			return (0);
+		bucket->items = items;
+		bucket->capacity = capacity;
+	}
+	bucket->items[bucket->size].key = key;
+	bucket->items[bucket->size++].data = data;
+	return (1);
+}
@@ -0,0 +1,37 @@
+#include "radix_heap.h"
+#include <stdlib.h>
+
+/**
+ * radix_heap_create - Creates a radix heap
+ *
+ * Description: The buckets are empty, their arrays are only allocated
+ * when an item is pushed in them
+ *
+ * Return: Pointer to the created heap, or NULL on failure
+ */
+radix_heap_t *radix_heap_create(void)
+{
+	return (calloc(1, sizeof(radix_heap_t)));
+}
+
+/**
+ * radix_heap_delete - Deallocates a radix heap
+ * @heap: Pointer to the heap to delete
+ * @free_data: Function to free the data of each item (can be NULL)
+ */
+void radix_heap_delete(radix_heap_t *heap, void (*free_data)(void *))
+{
+	size_t b, i;
+
+	if (heap == NULL)
+		return;
+
+	for (b = 0; b < RADIX_HEAP_NB_BUCKETS; b++)
+	{
+		if (free_data != NULL)
+			for (i = 0; i < heap->buckets[b].size; i++)
+				free_data(heap->buckets[b].items[i].data);
+		free(heap->buckets[b].items);
+	}
+	free(heap);
+}
@@ -0,0 +1,70 @@
+#include "radix_heap.h"
+
+/**
+ * redistribute - Makes the smallest key of a radix heap the last key,
+ * when no key equals the last one
+ * @heap: Pointer to the heap, not empty
+ *
+ * Description: The items of the first bucket that isn't empty move down
+ * to the buckets matching the new last key. They share more bits with it
+ * than with the previous one, so none of them stays where it was. The
+ * buckets below were empty, so on failure they are emptied again and the
+ * heap is left as it was.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int redistribute(radix_heap_t *heap)
+{
+	radix_heap_bucket_t *bucket;
+	radix_heap_item_t *item, *end;
+	size_t b, i, prev = heap->last;
+
+	for (b = 1; !heap->buckets[b].size; b++)
+		;
+	bucket = &heap->buckets[b];
+	heap->last = bucket->items[0].key;
+	for (i = 1; i < bucket->size; i++)
+		if (bucket->items[i].key < heap->last)
+			heap->last = bucket->items[i].key;
+	end = bucket->items + bucket->size;
+	for (item = bucket->items; item < end; item++)
+	{
+		i = radix_heap_bucket_index(item->key, heap->last);
+		if (!radix_heap_bucket_push(&heap->buckets[i], item->key,
+			item->data))
+		{
+			while (b-- > 0)
+				heap->buckets[b].size = 0;
+			heap->last = prev;
+			return (0);
+		}
+	}
+	bucket->size = 0;
+	return (1);
+}
+
+/**
+ * radix_heap_extract - Extracts an item of smallest key from a radix heap
+ * @heap: Pointer to the heap
+ * @key: Receives the key of the item (can be NULL)
+ *
+ * Return: Pointer to the data of the item, or NULL if the heap is empty
+ * or on failure
+ */
+void *radix_heap_extract(radix_heap_t *heap, size_t *key)
+{
+	radix_heap_bucket_t *bucket;
+
+	if (!heap || !heap->size)
+		return (NULL);
+
+	if (!heap->buckets[0].size && !redistribute(heap))
+		return (NULL);
+
+	bucket = &heap->buckets[0];
+	bucket->size--;
+	heap->size--;
+	if (key)
+		*key = bucket->items[bucket->size].key;
+	return (bucket->items[bucket->size].data);
+}
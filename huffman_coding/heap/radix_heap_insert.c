@@ -0,0 +1,24 @@
+#include "radix_heap.h"
+
+/**
+ * radix_heap_insert - Inserts an item in a radix heap
+ * @heap: Pointer to the heap
+ * @key: Priority of the item, not below the last key extracted
+ * @data: Pointer to the data to store
+ *
+ * Return: 1 on success, 0 on failure or if @key is below the last key
+ * extracted
+ */
+int radix_heap_insert(radix_heap_t *heap, size_t key, void *data)
+{
+	radix_heap_bucket_t *bucket;
+
+	if (!heap || key < heap->last)
+		return (0);
+
+	bucket = &heap->buckets[radix_heap_bucket_index(key, heap->last)];
+	if (!radix_heap_bucket_push(bucket, key, data))
+		return (0);
+	heap->size++;
+	return (1);
+}
@@ -2,24 +2,205 @@
 #define HUFFMAN_H
 
 #include <stdlib.h>
+#include <stdint.h>
 #include "heap/heap.h"
 
+/* Symbols are bytes, or ids of larger alphabets */
+typedef uint32_t huffman_symbol_t;
+
 /**
- * struct symbol_s - Stores a char and its associated frequency
+ * struct symbol_s - Stores a symbol and its associated frequency
  *
- * @data: The character
+ * @data: The symbol
+ * @internal: Set for the internal nodes of a Huffman tree, whose @data is
+ *   meaningless
  * @freq: The associated frequency
  */
 typedef struct symbol_s
 {
-	char data;
+	huffman_symbol_t data;
+	int internal;
 	size_t freq;
 } symbol_t;
 
+#define HUFFMAN_NB_SYMBOLS 256
+/* Largest alphabet the decoder handles, symbols being stored on 24 bits */
+#define HUFFMAN_MAX_SYMBOLS (1UL << 24)
+
+/**
+ * struct huffman_code_s - Huffman code of a symbol
+ *
+ * @bits: Bits of the code, the first bit being the most significant one
+ * @length: Number of bits of the code, 0 if the symbol has no code
+ */
+typedef struct huffman_code_s
+{
+	unsigned long bits;
+	unsigned int length;
+} huffman_code_t;
+
+#define HUFFMAN_MAX_CODE_LENGTH 32
+#define HUFFMAN_TABLE_BITS 11
+#define HUFFMAN_NB_STREAMS 4
+#define HUFFMAN_JUMP_TABLE_SIZE (4 * (HUFFMAN_NB_STREAMS - 1))
+
+/* Options of the compressors */
+#define HUFFMAN_FLAG_INTERLEAVED 1
+#define HUFFMAN_FLAG_TANS 2
+#define HUFFMAN_FLAG_REUSE 4
+#define HUFFMAN_FLAG_STATIC 8
+#define HUFFMAN_FLAG_NO_STATIC 16
+/* Options selecting static table @id, see huffman_static_table */
+#define HUFFMAN_FLAG_TABLE_SHIFT 8
+#define HUFFMAN_FLAG_TABLE(id) \
+	(HUFFMAN_FLAG_STATIC | (unsigned int)(id) << HUFFMAN_FLAG_TABLE_SHIFT)
+
+#define HUFFMAN_TANS_LOG 11
+#define HUFFMAN_TANS_SIZE (1 << HUFFMAN_TANS_LOG)
+/* Bits giving the length of each normalized frequency in a tANS header */
+#define HUFFMAN_TANS_COUNT_BITS 4
+
+/**
+ * struct huffman_decoder_s - Lookup tables decoding canonical Huffman codes
+ *
+ * @primary: Entries indexed by the next HUFFMAN_TABLE_BITS bits of input.
+ *   An entry holds a symbol in its upper 24 bits and the length of its
+ *   code in its lower 8 bits. For codes longer than HUFFMAN_TABLE_BITS,
+ *   bit 7 is set, the lower 7 bits are the number of extra bits to index
+ *   @secondary with, and the upper 24 bits the offset of the sub-table.
+ *   A length of 0 marks bits no code starts with.
+ * @secondary: Sub-tables of the longer codes
+ * @max_length: Length of the longest code
+ */
+typedef struct huffman_decoder_s
+{
+	uint32_t primary[1 << HUFFMAN_TABLE_BITS];
+	uint32_t *secondary;
+	unsigned int max_length;
+} huffman_decoder_t;
+
+/**
+ * struct huffman_node_pool_s - Nodes of a Huffman tree and their symbols,
+ * allocated at once and referred to by index
+ *
+ * @nodes: The 2 * @size - 1 nodes, the leaves last
+ * @symbols: Symbol of each node, at the same index
+ * @size: Number of leaves
+ * @next: Number of nodes left for merges, the next one being at index
+ *   @next - 1
+ */
+typedef struct huffman_node_pool_s
+{
+	binary_tree_node_t *nodes;
+	symbol_t *symbols;
+	size_t size;
+	size_t next;
+} huffman_node_pool_t;
+
+#define HUFFMAN_NO_NODE ((size_t)-1)
+
+/**
+ * struct huffman_tans_s - Tables of a table-ANS coder, whose states go from
+ * HUFFMAN_TANS_SIZE to 2 * HUFFMAN_TANS_SIZE - 1
+ *
+ * @decode: Entry of each state minus HUFFMAN_TANS_SIZE. An entry holds
+ *   the symbol in its lower 8 bits, the number of bits to read in bits 8
+ *   to 15, and in its upper 16 bits the value these bits are added to, to
+ *   get the next state minus HUFFMAN_TANS_SIZE.
+ * @encode: States reached by encoding each symbol, from @start[symbol],
+ *   one for each value of the previous state shifted right into
+ *   [@counts[symbol], 2 * @counts[symbol])
+ * @counts: Normalized frequency of each symbol, their sum being
+ *   HUFFMAN_TANS_SIZE
+ * @start: Sum of the normalized frequencies of the symbols before each one
+ * @threshold: States from which each symbol is encoded with @bits bits,
+ *   rather than @bits - 1
+ * @bits: Most bits written when encoding each symbol
+ */
+typedef struct huffman_tans_s
+{
+	uint32_t decode[HUFFMAN_TANS_SIZE];
+	uint16_t encode[HUFFMAN_TANS_SIZE];
+	uint16_t counts[HUFFMAN_NB_SYMBOLS];
+	uint16_t start[HUFFMAN_NB_SYMBOLS];
+	uint32_t threshold[HUFFMAN_NB_SYMBOLS];
+	unsigned char bits[HUFFMAN_NB_SYMBOLS];
+} huffman_tans_t;
+
+/**
+ * struct huffman_static_s - Codes trained offline on a sample and
+ * compiled in, which blocks and messages are encoded and decoded with
+ * without building anything
+ *
+ * @lengths: Code length of each byte, none of them 0 nor longer than
+ *   HUFFMAN_TABLE_BITS
+ * @codes: Canonical codes of @lengths
+ * @decoder: Decoding tables of @codes, without secondary tables
+ */
+typedef struct huffman_static_s
+{
+	unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+	huffman_code_t codes[HUFFMAN_NB_SYMBOLS];
+	huffman_decoder_t decoder;
+} huffman_static_t;
+
 /* Function prototypes */
-symbol_t *symbol_create(char data, size_t freq);
+symbol_t *symbol_create(huffman_symbol_t data, size_t freq);
 int huffman_extract_and_insert(heap_t *priority_queue);
-heap_t *huffman_priority_queue(char *data, size_t *freq, size_t size);
+heap_t *huffman_priority_queue(huffman_symbol_t *data, size_t *freq,
+	size_t size);
+int huffman_node_pool_init(huffman_node_pool_t *pool, huffman_symbol_t *data,
+	size_t *freq, size_t size);
+size_t huffman_node_pool_merge(huffman_node_pool_t *pool, size_t left,
+	size_t right);
+binary_tree_node_t *huffman_tree(huffman_symbol_t *data, size_t *freq,
+	size_t size);
+int huffman_codes(const binary_tree_node_t *root, huffman_code_t *codes,
+	size_t size);
+int huffman_histogram(const unsigned char *buf, size_t len, size_t *freq);
+size_t huffman_histogram_blocks(const unsigned char *buf, size_t len,
+	size_t block_size, size_t *freq);
+int huffman_code_lengths(const size_t *freq, size_t size,
+	unsigned int max_length, unsigned char *lengths);
+int huffman_canonical_codes(const unsigned char *lengths, size_t size,
+	huffman_code_t *codes);
+huffman_decoder_t *huffman_decoder_create(const unsigned char *lengths,
+	size_t size);
+void huffman_decoder_delete(huffman_decoder_t *decoder);
+size_t huffman_encode(const huffman_code_t *codes, const unsigned char *in,
+	size_t in_size, unsigned char *out, size_t out_size);
+int huffman_decode(const huffman_decoder_t *decoder, const unsigned char *in,
+	size_t in_size, unsigned char *out, size_t out_size);
+size_t huffman_encode_symbols(const huffman_code_t *codes,
+	const huffman_symbol_t *in, size_t in_size, unsigned char *out,
+	size_t out_size);
+int huffman_decode_symbols(const huffman_decoder_t *decoder,
+	const unsigned char *in, size_t in_size, huffman_symbol_t *out,
+	size_t out_size);
+size_t huffman_encode4(const huffman_code_t *codes, const unsigned char *in,
+	size_t in_size, unsigned char *out, size_t out_size);
+int huffman_decode4(const huffman_decoder_t *decoder, const unsigned char *in,
+	size_t in_size, unsigned char *out, size_t out_size);
+int huffman_static_train(const size_t *freq, unsigned char *lengths);
+const huffman_static_t *huffman_static_table(unsigned int id);
+int huffman_tans_normalize(const size_t *freq, uint16_t *counts);
+size_t huffman_tans_cost(const size_t *freq, const uint16_t *counts);
+int huffman_tans_init(huffman_tans_t *tans, const uint16_t *counts);
+size_t huffman_tans_encode(const huffman_tans_t *tans, const unsigned char *in,
+	size_t in_size, unsigned char *out, size_t out_size);
+int huffman_tans_decode(const huffman_tans_t *tans, const unsigned char *in,
+	size_t in_size, unsigned char *out, size_t out_size);
+size_t huffman_tans_compress(const unsigned char *in, size_t in_size,
+	const uint16_t *counts, unsigned char *out, size_t out_size);
+int huffman_tans_decompress(const unsigned char *in, size_t in_size,
+	unsigned char *out, size_t out_size);
+int huffman_compress_stream(int in_fd, int out_fd, unsigned int flags);
+int huffman_decompress_stream(int in_fd, int out_fd);
+int huffman_compress_stream_mt(int in_fd, int out_fd, size_t nb_threads,
+	unsigned int flags);
+int huffman_decompress_stream_mt(int in_fd, int out_fd, size_t nb_threads);
+int huffman_adaptive_compress_stream(int in_fd, int out_fd);
+int huffman_adaptive_decompress_stream(int in_fd, int out_fd);
 
 #endif /* HUFFMAN_H */
 
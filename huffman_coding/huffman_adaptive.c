@@ -0,0 +1,92 @@
+#include "huffman_stream.h"
+#include <string.h>
+
+/**
+ * rebuild - Builds the codes and the decoding table of an adaptive model
+ * from its counts
+ * @model: Pointer to the model
+ *
+ * Description: Codes are limited to HUFFMAN_TABLE_BITS bits, so the
+ * decoding table has a single level and needs no allocation
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int rebuild(huffman_adaptive_t *model)
+{
+	unsigned char lengths[HUFFMAN_ADAPTIVE_SYMBOLS];
+	size_t i, first, n, shift;
+
+	if (!huffman_code_lengths(model->freq, HUFFMAN_ADAPTIVE_SYMBOLS,
+		HUFFMAN_TABLE_BITS, lengths) ||
+		!huffman_canonical_codes(lengths, HUFFMAN_ADAPTIVE_SYMBOLS,
+		model->codes))
+		return (0);
+	for (i = 0; i < HUFFMAN_ADAPTIVE_SYMBOLS; i++)
+	{
+		shift = HUFFMAN_TABLE_BITS - lengths[i];
+		first = model->codes[i].bits << shift;
+		for (n = 0; n < (size_t)1 << shift; n++)
+			model->decode[first + n] = HUFFMAN_ENTRY(i, lengths[i]);
+	}
+	return (1);
+}
+
+/**
+ * huffman_adaptive_init - Initializes the model of an adaptive coder,
+ * every symbol starting with the same count
+ * @model: Pointer to the model
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_adaptive_init(huffman_adaptive_t *model)
+{
+	size_t i;
+
+	if (!model)
+		return (0);
+	for (i = 0; i < HUFFMAN_ADAPTIVE_SYMBOLS; i++)
+		model->freq[i] = 1;
+	model->total = HUFFMAN_ADAPTIVE_SYMBOLS;
+	model->interval = HUFFMAN_ADAPTIVE_START;
+	model->left = model->interval;
+	model->ended = 0;
+	return (rebuild(model));
+}
+
+/**
+ * huffman_adaptive_update - Counts a symbol just coded, rebuilding the
+ * codes when it is time to
+ * @model: Pointer to the model
+ * @symbol: The symbol, a byte, HUFFMAN_ADAPTIVE_FLUSH or
+ *   HUFFMAN_ADAPTIVE_END
+ *
+ * Description: Rebuilds happen after HUFFMAN_ADAPTIVE_START symbols, then
+ * twice as many each time up to HUFFMAN_ADAPTIVE_INTERVAL, so the codes
+ * fit the data early while a symbol never costs more than a share of one
+ * rebuild. Counts are halved once they sum to HUFFMAN_ADAPTIVE_LIMIT, so
+ * the codes follow data whose statistics drift.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_adaptive_update(huffman_adaptive_t *model, unsigned int symbol)
+{
+	size_t i;
+
+	model->freq[symbol]++;
+	model->total++;
+	if (--model->left)
+		return (1);
+	if (model->total >= HUFFMAN_ADAPTIVE_LIMIT)
+	{
+		model->total = 0;
+		for (i = 0; i < HUFFMAN_ADAPTIVE_SYMBOLS; i++)
+		{
+			model->freq[i] = (model->freq[i] + 1) / 2;
+			model->total += model->freq[i];
+		}
+	}
+	if (model->interval < HUFFMAN_ADAPTIVE_INTERVAL)
+		model->interval *= 2;
+	model->left = model->interval;
+	return (rebuild(model));
+}
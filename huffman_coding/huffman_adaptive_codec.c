@@ -0,0 +1,125 @@
+#include "huffman_stream.h"
+
+/**
+ * huffman_adaptive_encode - Encodes bytes with an adaptive coder, ending
+ * them with a flush so that they can be decoded at once
+ * @model: Pointer to the model, updated after each symbol
+ * @in: Bytes to encode
+ * @in_size: Number of bytes
+ * @out: Buffer receiving the encoded bits
+ * @out_size: Size of @out, HUFFMAN_ADAPTIVE_BOUND(@in_size) is always
+ *   enough
+ *
+ * Description: The flush is padded with zeros to a byte boundary, so that
+ * the output of each call can be sent as it is. The model is updated even
+ * if @out is too small, and can't be used any more then.
+ *
+ * Return: Number of bytes written, or 0 on failure or if @out is too small
+ */
+size_t huffman_adaptive_encode(huffman_adaptive_t *model,
+		const unsigned char *in, size_t in_size, unsigned char *out,
+		size_t out_size)
+{
+	bit_writer_t writer;
+	unsigned int symbol;
+	size_t i;
+
+	writer.out = out;
+	writer.end = out + out_size;
+	writer.acc = 0;
+	writer.count = 0;
+	writer.overflow = 0;
+	for (i = 0; i <= in_size; i++)
+	{
+		symbol = i < in_size ? in[i] : HUFFMAN_ADAPTIVE_FLUSH;
+		bit_write(&writer, model->codes[symbol].bits,
+			model->codes[symbol].length);
+		if (!huffman_adaptive_update(model, symbol))
+			return (0);
+	}
+	bit_flush(&writer);
+	return (writer.overflow ? 0 : (size_t)(writer.out - out));
+}
+
+/**
+ * huffman_adaptive_end - Encodes the end of a stream of an adaptive coder
+ * @model: Pointer to the model, as left by the last huffman_adaptive_encode
+ * @out: Buffer receiving the encoded bits
+ * @out_size: Size of @out, HUFFMAN_ADAPTIVE_BOUND(0) is always enough
+ *
+ * Description: HUFFMAN_ADAPTIVE_END is padded with zeros to a byte
+ * boundary. Nothing can be encoded after it.
+ *
+ * Return: Number of bytes written, or 0 on failure or if @out is too small
+ */
+size_t huffman_adaptive_end(const huffman_adaptive_t *model,
+		unsigned char *out, size_t out_size)
+{
+	bit_writer_t writer;
+
+	if (!model || !out)
+		return (0);
+	writer.out = out;
+	writer.end = out + out_size;
+	writer.acc = 0;
+	writer.count = 0;
+	writer.overflow = 0;
+	bit_write(&writer, model->codes[HUFFMAN_ADAPTIVE_END].bits,
+		model->codes[HUFFMAN_ADAPTIVE_END].length);
+	bit_flush(&writer);
+	return (writer.overflow ? 0 : (size_t)(writer.out - out));
+}
+
+/**
+ * huffman_adaptive_decode - Decodes bytes encoded with an adaptive coder
+ * @model: Pointer to the model, updated after each symbol
+ * @reader: Pointer to a bit reader over the input, which keeps the bits
+ *   of an unfinished code from one call to the next
+ * @out: Buffer receiving the decoded bytes
+ * @out_size: Size of @out
+ *
+ * Description: Decoding stops when @out is full, or when the input of
+ * @reader ends before the next code does: the caller then points @reader
+ * to the next input and calls again. Once HUFFMAN_ADAPTIVE_END is
+ * decoded, @model is marked as ended and any input left is invalid. The
+ * stream is whole when @model is ended.
+ *
+ * Return: Number of bytes decoded, or (size_t)-1 if the input is invalid
+ * or on failure
+ */
+size_t huffman_adaptive_decode(huffman_adaptive_t *model,
+		bit_reader_t *reader, unsigned char *out, size_t out_size)
+{
+	size_t done = 0;
+	uint32_t entry, symbol, length, pad;
+
+	while (done < out_size)
+	{
+		if (model->ended)
+			return (reader->count || reader->in < reader->end ?
+				(size_t)-1 : done);
+		bit_refill(reader);
+		entry = model->decode[reader->buf >> (64 - HUFFMAN_TABLE_BITS)];
+		length = entry & 0xff;
+		if (length > reader->count)
+			break;
+		symbol = entry >> 8;
+		reader->buf <<= length;
+		reader->count -= length;
+		if (symbol == HUFFMAN_ADAPTIVE_FLUSH ||
+			symbol == HUFFMAN_ADAPTIVE_END)
+		{
+			pad = reader->count % 8;
+			if (pad && reader->buf >> (64 - pad))
+				return ((size_t)-1);
+			reader->buf <<= pad;
+			reader->count -= pad;
+			model->ended = symbol == HUFFMAN_ADAPTIVE_END;
+		}
+		else
+			out[done++] = symbol;
+		if (!huffman_adaptive_update(model, symbol))
+			return ((size_t)-1);
+	}
+	return (done);
+}
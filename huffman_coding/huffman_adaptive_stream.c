@@ -0,0 +1,108 @@
+#include "huffman_stream.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * huffman_adaptive_compress_stream - Compresses everything read from a
+ * file descriptor to another one, in a single pass with an adaptive coder
+ * @in_fd: File descriptor to read from
+ * @out_fd: File descriptor to write to
+ *
+ * Description: Whatever a read returns is encoded and written at once,
+ * ending with a flush, so a message arriving on a pipe or a socket is
+ * sent on without waiting for HUFFMAN_BLOCK_SIZE bytes, and without a
+ * table in front of it. The end of the input is written as
+ * HUFFMAN_ADAPTIVE_END, so that a stream cut at a flush isn't taken for a
+ * whole one.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_adaptive_compress_stream(int in_fd, int out_fd)
+{
+	huffman_adaptive_t model;
+	unsigned char *in, *out;
+	size_t size;
+	int ok;
+
+	in = malloc(HUFFMAN_BLOCK_SIZE);
+	out = malloc(HUFFMAN_ADAPTIVE_BOUND(HUFFMAN_BLOCK_SIZE));
+	ok = in && out && huffman_adaptive_init(&model);
+	if (ok)
+	{
+		memcpy(out, HUFFMAN_ADAPTIVE_MAGIC, 4);
+		out[4] = HUFFMAN_ADAPTIVE_VERSION;
+		ok = huffman_write_full(out_fd, out,
+			HUFFMAN_STREAM_HEADER_SIZE);
+	}
+	while (ok)
+	{
+		size = huffman_read_some(in_fd, in, HUFFMAN_BLOCK_SIZE);
+		if (size == (size_t)-1)
+			ok = 0;
+		if (!ok || !size)
+			break;
+		size = huffman_adaptive_encode(&model, in, size, out,
+			HUFFMAN_ADAPTIVE_BOUND(HUFFMAN_BLOCK_SIZE));
+		ok = size && huffman_write_full(out_fd, out, size);
+	}
+	if (ok)
+	{
+		size = huffman_adaptive_end(&model, out,
+			HUFFMAN_ADAPTIVE_BOUND(0));
+		ok = size && huffman_write_full(out_fd, out, size);
+	}
+	free(in);
+	free(out);
+	return (ok);
+}
+
+/**
+ * huffman_adaptive_decompress_stream - Decompresses a stream written by
+ * huffman_adaptive_compress_stream
+ * @in_fd: File descriptor to read from
+ * @out_fd: File descriptor to write to
+ *
+ * Description: Bytes are written as soon as their codes are read, so
+ * each flush of the compressor comes out whole as soon as it comes in.
+ * The input is read to its end, which must be the end of the stream.
+ *
+ * Return: 1 on success, 0 if the stream is invalid, truncated or followed
+ * by more input, or on failure
+ */
+int huffman_adaptive_decompress_stream(int in_fd, int out_fd)
+{
+	huffman_adaptive_t model;
+	bit_reader_t reader;
+	unsigned char *in, *out;
+	size_t size, done;
+	int ok;
+
+	in = malloc(HUFFMAN_BLOCK_SIZE);
+	out = malloc(HUFFMAN_BLOCK_SIZE);
+	ok = in && out && huffman_adaptive_init(&model) &&
+		huffman_read_full(in_fd, in, HUFFMAN_STREAM_HEADER_SIZE) ==
+		HUFFMAN_STREAM_HEADER_SIZE &&
+		!memcmp(in, HUFFMAN_ADAPTIVE_MAGIC, 4) &&
+		in[4] == HUFFMAN_ADAPTIVE_VERSION;
+	reader.buf = 0;
+	reader.count = 0;
+	while (ok)
+	{
+		size = huffman_read_some(in_fd, in, HUFFMAN_BLOCK_SIZE);
+		if (size == (size_t)-1)
+			ok = 0;
+		if (!ok || !size)
+			break;
+		reader.in = in;
+		reader.end = in + size;
+		do {
+			done = huffman_adaptive_decode(&model, &reader, out,
+				HUFFMAN_BLOCK_SIZE);
+			ok = done != (size_t)-1 &&
+				huffman_write_full(out_fd, out, done);
+		} while (ok && done == HUFFMAN_BLOCK_SIZE);
+	}
+	free(in);
+	free(out);
+	return (ok && model.ended);
+}
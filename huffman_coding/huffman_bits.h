@@ -0,0 +1,216 @@
+#ifndef HUFFMAN_BITS_H
+#define HUFFMAN_BITS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "huffman.h"
+
+/*
+ * Bits are packed most significant first, the way codes are written in
+ * huffman_code_t, so that the next bits of input read as an integer index
+ * the decoding table directly
+ */
+
+#define HUFFMAN_ENTRY(symbol, length) ((uint32_t)(symbol) << 8 | (length))
+#define HUFFMAN_LINK(offset, bits) ((uint32_t)(offset) << 8 | 0x80 | (bits))
+
+/**
+ * struct bit_writer_s - Writes bits to a buffer, a 32-bit word at a time
+ *
+ * @out: Where the next word goes
+ * @end: End of the buffer
+ * @acc: Accumulator, its lower @count bits are waiting to be written
+ * @count: Number of bits waiting, less than 32 between two writes
+ * @overflow: Set if the buffer was too small
+ */
+typedef struct bit_writer_s
+{
+	unsigned char *out;
+	unsigned char *end;
+	uint64_t acc;
+	unsigned int count;
+	int overflow;
+} bit_writer_t;
+
+/**
+ * struct bit_reader_s - Reads bits from a buffer, refilled 64 bits at a time
+ *
+ * @in: Next byte to load
+ * @end: End of the buffer
+ * @buf: Bit buffer, the next bit to read being the most significant one
+ * @count: Number of valid bits in @buf
+ */
+typedef struct bit_reader_s
+{
+	const unsigned char *in;
+	const unsigned char *end;
+	uint64_t buf;
+	unsigned int count;
+} bit_reader_t;
+
+/**
+ * load_be64 - Loads 8 bytes as a big-endian integer
+ * @p: Pointer to the bytes
+ *
+ * Return: The integer, compilers turn this into a load and a byte swap
+ */
+static inline uint64_t load_be64(const unsigned char *p)
+{
+	return ((uint64_t)p[0] << 56 | (uint64_t)p[1] << 48 |
+		(uint64_t)p[2] << 40 | (uint64_t)p[3] << 32 |
+		(uint64_t)p[4] << 24 | (uint64_t)p[5] << 16 |
+		(uint64_t)p[6] << 8 | (uint64_t)p[7]);
+}
+
+/**
+ * store_be32 - Stores a 32-bit integer as 4 big-endian bytes
+ * @p: Where to store the bytes
+ * @value: Integer to store
+ */
+static inline void store_be32(unsigned char *p, uint32_t value)
+{
+	p[0] = value >> 24;
+	p[1] = value >> 16;
+	p[2] = value >> 8;
+	p[3] = value;
+}
+
+/**
+ * load_be32 - Loads 4 bytes as a big-endian integer
+ * @p: Pointer to the bytes
+ *
+ * Return: The integer
+ */
+static inline uint32_t load_be32(const unsigned char *p)
+{
+	return ((uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 |
+		(uint32_t)p[2] << 8 | (uint32_t)p[3]);
+}
+
+/**
+ * bit_write - Appends bits to a bit writer
+ * @writer: Pointer to the writer
+ * @bits: Bits to write, right-aligned
+ * @length: Number of bits to write, at most 32
+ */
+static inline void bit_write(bit_writer_t *writer, uint32_t bits,
+		unsigned int length)
+{
+	uint32_t word;
+
+	writer->acc = writer->acc << length | bits;
+	writer->count += length;
+	if (writer->count < 32)
+		return;
+	writer->count -= 32;
+	if (writer->end - writer->out < 4)
+	{
+		writer->overflow = 1;
+		return;
+	}
+	word = (uint32_t)(writer->acc >> writer->count);
+	writer->out[0] = word >> 24;
+	writer->out[1] = word >> 16;
+	writer->out[2] = word >> 8;
+	writer->out[3] = word;
+	writer->out += 4;
+}
+
+/**
+ * bit_flush - Writes the bits left in a bit writer, the last byte being
+ * padded with zeros
+ * @writer: Pointer to the writer
+ */
+static inline void bit_flush(bit_writer_t *writer)
+{
+	unsigned int pad = (8 - writer->count % 8) % 8;
+
+	writer->acc <<= pad;
+	writer->count += pad;
+	while (writer->count)
+	{
+		if (writer->out == writer->end)
+		{
+			writer->overflow = 1;
+			return;
+		}
+		writer->count -= 8;
+		*writer->out++ = (unsigned char)(writer->acc >> writer->count);
+	}
+}
+
+/**
+ * bit_refill - Fills the bit buffer of a bit reader
+ * @reader: Pointer to the reader
+ *
+ * Description: Away from the end of the input, 8 bytes are loaded at once
+ * and only the whole bytes that fit are consumed, which leaves between 56
+ * and 63 valid bits without any loop. Past the end of the input, the
+ * buffer is filled with zeros.
+ */
+static inline void bit_refill(bit_reader_t *reader)
+{
+	if (reader->end - reader->in >= 8)
+	{
+		reader->buf |= load_be64(reader->in) >> reader->count;
+		reader->in += (63 - reader->count) >> 3;
+		reader->count |= 56;
+		return;
+	}
+	while (reader->count <= 56 && reader->in < reader->end)
+	{
+		reader->buf |= (uint64_t)*reader->in++ << (56 - reader->count);
+		reader->count += 8;
+	}
+}
+
+/**
+ * huffman_decode_entry - Looks up the next code of a bit reader
+ * @decoder: Pointer to the decoding tables
+ * @buf: Bit buffer of the reader
+ *
+ * Return: The entry of the code, holding its symbol and length
+ */
+static inline uint32_t huffman_decode_entry(const huffman_decoder_t *decoder,
+		uint64_t buf)
+{
+	uint32_t entry;
+
+	entry = decoder->primary[buf >> (64 - HUFFMAN_TABLE_BITS)];
+	if (entry & 0x80)
+		entry = decoder->secondary[(entry >> 8) +
+			(uint32_t)((buf << HUFFMAN_TABLE_BITS) >>
+			(64 - (entry & 0x7f)))];
+	return (entry);
+}
+
+/**
+ * huffman_decode_checked - Decodes symbols one at a time, checking each code
+ * @decoder: Pointer to the decoding tables of the codes
+ * @reader: Pointer to the bit reader
+ * @out: Buffer receiving the decoded bytes
+ * @end: End of @out
+ *
+ * Return: 1 on success, 0 if the input is invalid or too short
+ */
+static inline int huffman_decode_checked(const huffman_decoder_t *decoder,
+		bit_reader_t *reader, unsigned char *out, unsigned char *end)
+{
+	unsigned int length;
+	uint32_t entry;
+
+	while (out < end)
+	{
+		bit_refill(reader);
+		entry = huffman_decode_entry(decoder, reader->buf);
+		length = entry & 0x3f;
+		if (!length || length > reader->count)
+			return (0);
+		*out++ = (unsigned char)(entry >> 8);
+		reader->buf <<= length;
+		reader->count -= length;
+	}
+	return (1);
+}
+
+#endif /* HUFFMAN_BITS_H */
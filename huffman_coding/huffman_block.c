@@ -0,0 +1,259 @@
+#include "huffman_stream.h"
+#include <string.h>
+
+/* tANS must save 1 / 2^TANS_MARGIN_SHIFT of a block, decoding slower */
+#define TANS_MARGIN_SHIFT 7
+
+/**
+ * huffman_cost - Computes the size of the bytes of a block encoded with
+ * given code lengths
+ * @freq: Frequency of each byte
+ * @lengths: Code length of each byte
+ *
+ * Return: Size of the encoded bytes, code lengths not included, or
+ * (size_t)-1 if a byte that occurs has no code
+ */
+static size_t huffman_cost(const size_t *freq, const unsigned char *lengths)
+{
+	size_t bits = 0, i;
+
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+	{
+		if (freq[i] && !lengths[i])
+			return ((size_t)-1);
+		bits += freq[i] * lengths[i];
+	}
+	return ((bits + 7) / 8);
+}
+
+/**
+ * choose_table - Chooses where a Huffman block takes its code lengths
+ * from, and writes them at the start of its payload
+ * @freq: Frequency of each byte of the block
+ * @lengths: Code lengths built for the block
+ * @table: Code lengths of the last Huffman block, or NULL
+ * @flags: HUFFMAN_FLAG_NO_STATIC not to try the static tables
+ * @out: Buffer receiving the block, whose type gets the chosen
+ *   HUFFMAN_TABLE_* mode
+ * @chosen: Receives the code lengths to encode the block with, NULL if
+ *   none fit
+ * @cost: Receives the size of the payload, (size_t)-1 if no lengths fit
+ *
+ * Description: The lengths of the block are written with
+ * huffman_lengths_write, unless a static table, or the lengths of the
+ * last block, make a smaller payload, reusing them winning ties
+ *
+ * Return: Number of bytes written to the payload
+ */
+static size_t choose_table(const size_t *freq, const unsigned char *lengths,
+		const huffman_table_t *table, unsigned int flags,
+		unsigned char *out, const unsigned char **chosen, size_t *cost)
+{
+	unsigned char *payload = out + HUFFMAN_BLOCK_HEADER_SIZE;
+	const huffman_static_t *fixed;
+	unsigned int mode = HUFFMAN_TABLE_RLE, id;
+	size_t header, size;
+
+	header = huffman_lengths_write(lengths, payload, HUFFMAN_LENGTHS_BOUND);
+	size = huffman_cost(freq, lengths);
+	*cost = header && size != (size_t)-1 ? header + size : (size_t)-1;
+	*chosen = *cost != (size_t)-1 ? lengths : NULL;
+	for (id = 0; !(flags & HUFFMAN_FLAG_NO_STATIC) &&
+		(fixed = huffman_static_table(id)); id++)
+	{
+		size = huffman_cost(freq, fixed->lengths);
+		if (size != (size_t)-1 && 1 + size < *cost)
+		{
+			mode = HUFFMAN_TABLE_PREDEFINED;
+			payload[0] = id;
+			header = 1;
+			*chosen = fixed->lengths;
+			*cost = 1 + size;
+		}
+	}
+	size = table ? huffman_cost(freq, table->lengths) : (size_t)-1;
+	if (size != (size_t)-1 && size <= *cost)
+	{
+		mode = HUFFMAN_TABLE_REUSE;
+		header = 0;
+		*chosen = table->lengths;
+		*cost = size;
+	}
+	out[0] |= mode;
+	return (header);
+}
+
+/**
+ * huffman_block_compress - Compresses a block of bytes
+ * @in: Bytes to compress
+ * @in_size: Number of bytes, at most HUFFMAN_BLOCK_SIZE
+ * @flags: HUFFMAN_FLAG_INTERLEAVED to encode Huffman blocks in
+ *   HUFFMAN_NB_STREAMS streams, HUFFMAN_FLAG_TANS to let blocks be
+ *   encoded with tANS, HUFFMAN_FLAG_TABLE(id) to encode them with static
+ *   table id, HUFFMAN_FLAG_NO_STATIC not to try the
+ *   static tables
+ * @table: Code lengths of the last Huffman block of the stream, updated
+ *   if this one is a Huffman block, or NULL not to reuse them
+ * @out: Buffer receiving the block header and payload, of at least
+ *   HUFFMAN_BLOCK_BOUND bytes
+ *
+ * Description: The codes are limited to HUFFMAN_TABLE_BITS bits, so that
+ * every symbol is decoded with a single lookup. The code lengths are
+ * stored as choose_table tells. A static table given in @flags is used
+ * without counting the bytes nor building codes. With HUFFMAN_FLAG_TANS,
+ * the size of the payload is estimated from the histogram for both
+ * coders, and the block goes to tANS if it is clearly smaller. The block
+ * is stored raw when coding it doesn't make it smaller.
+ *
+ * Return: Number of bytes written
+ */
+size_t huffman_block_compress(const unsigned char *in, size_t in_size,
+		unsigned int flags, huffman_table_t *table, unsigned char *out)
+{
+	size_t freq[HUFFMAN_NB_SYMBOLS] = {0}, header = 0, size = 0;
+	size_t cost = (size_t)-1;
+	unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+	const unsigned char *chosen = NULL;
+	huffman_code_t own[HUFFMAN_NB_SYMBOLS];
+	const huffman_code_t *codes = NULL;
+	const huffman_static_t *fixed = NULL;
+	uint16_t counts[HUFFMAN_NB_SYMBOLS];
+	unsigned char *payload = out + HUFFMAN_BLOCK_HEADER_SIZE;
+
+	out[0] = flags & HUFFMAN_FLAG_INTERLEAVED ? HUFFMAN_BLOCK_HUFFMAN4 :
+		HUFFMAN_BLOCK_HUFFMAN;
+	if (flags & HUFFMAN_FLAG_STATIC)
+		fixed = huffman_static_table(flags >> HUFFMAN_FLAG_TABLE_SHIFT);
+	if (fixed)
+	{
+		out[0] |= HUFFMAN_TABLE_PREDEFINED;
+		payload[0] = flags >> HUFFMAN_FLAG_TABLE_SHIFT;
+		header = 1;
+		chosen = fixed->lengths;
+	}
+	else if (huffman_histogram(in, in_size, freq) &&
+		huffman_code_lengths(freq, HUFFMAN_NB_SYMBOLS,
+			HUFFMAN_TABLE_BITS, lengths))
+		header = choose_table(freq, lengths, table, flags, out,
+			&chosen, &cost);
+	cost -= cost >> TANS_MARGIN_SHIFT;
+	if (flags & HUFFMAN_FLAG_TANS && huffman_tans_normalize(freq, counts) &&
+		huffman_tans_cost(freq, counts) < cost)
+	{
+		out[0] = HUFFMAN_BLOCK_TANS;
+		size = huffman_tans_compress(in, in_size, counts, payload,
+			in_size);
+	}
+	else if (chosen && header < in_size)
+	{
+		if ((out[0] & HUFFMAN_TABLE_MASK) == HUFFMAN_TABLE_PREDEFINED)
+			codes = huffman_static_table(payload[0])->codes;
+		else if (huffman_canonical_codes(chosen, HUFFMAN_NB_SYMBOLS,
+				own))
+			codes = own;
+		if (codes && flags & HUFFMAN_FLAG_INTERLEAVED)
+			size = huffman_encode4(codes, in, in_size,
+				payload + header, in_size - header);
+		else if (codes)
+			size = huffman_encode(codes, in, in_size,
+				payload + header, in_size - header);
+		if (size && table)
+			huffman_table_set(table, chosen);
+		if (size)
+			size += header;
+	}
+	if (!size)
+	{
+		out[0] = HUFFMAN_BLOCK_RAW;
+		memcpy(payload, in, size = in_size);
+	}
+	store_be32(out + 1, in_size);
+	store_be32(out + 5, size);
+	return (HUFFMAN_BLOCK_HEADER_SIZE + size);
+}
+
+/**
+ * read_table - Reads the code lengths stored in a Huffman block into a
+ * table
+ * @payload: Payload of the block
+ * @size: Size of the payload
+ * @mode: HUFFMAN_TABLE_* mode of the block, but HUFFMAN_TABLE_PREDEFINED
+ * @table: Code lengths of the last Huffman block, replaced by those of
+ *   this one
+ *
+ * Return: Number of bytes of the payload taken by the lengths, or
+ * (size_t)-1 if they are invalid
+ */
+static size_t read_table(const unsigned char *payload, size_t size,
+		unsigned int mode, huffman_table_t *table)
+{
+	unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+	size_t used;
+
+	if (mode == HUFFMAN_TABLE_REUSE)
+		return (0);
+	if (mode == HUFFMAN_TABLE_RLE)
+		used = huffman_lengths_read(payload, size, lengths);
+	else
+		used = huffman_lengths_read_packed(payload, size, lengths);
+	if (!used || !huffman_table_set(table, lengths))
+		return ((size_t)-1);
+	return (used);
+}
+
+/**
+ * huffman_block_decompress - Decompresses a block
+ * @header: Block header
+ * @payload: Payload of the block, of the size given in its header
+ * @table: Code lengths of the last Huffman block of the stream, updated
+ *   if this one is a Huffman block, or NULL if blocks don't reuse them
+ * @out: Buffer receiving the bytes, of the size given in the header
+ *
+ * Description: Blocks naming a static table are decoded with its
+ * compiled decoding tables. Other decoding tables are kept in @table, so
+ * that blocks reusing the lengths of the block before don't build them
+ * again.
+ *
+ * Return: 1 on success, 0 if the block is invalid
+ */
+int huffman_block_decompress(const unsigned char *header,
+		const unsigned char *payload, huffman_table_t *table,
+		unsigned char *out)
+{
+	huffman_table_t local, *lengths = table ? table : &local;
+	const huffman_static_t *fixed = NULL;
+	const huffman_decoder_t *decoder = NULL;
+	size_t raw_size = load_be32(header + 1), size = load_be32(header + 5);
+	size_t used = 1;
+	int mode = huffman_table_mode(header[0]), ok;
+
+	if (header[0] == HUFFMAN_BLOCK_RAW && size == raw_size)
+	{
+		memcpy(out, payload, size);
+		return (1);
+	}
+	if (header[0] == HUFFMAN_BLOCK_TANS)
+		return (huffman_tans_decompress(payload, size, out, raw_size));
+	if (mode == -1)
+		return (0);
+	if (mode == HUFFMAN_TABLE_PREDEFINED && size)
+		fixed = huffman_static_table(payload[0]);
+	if (fixed && (!table || huffman_table_set(table, fixed->lengths)))
+		decoder = &fixed->decoder;
+	if (!table)
+		huffman_table_init(&local);
+	if (mode != HUFFMAN_TABLE_PREDEFINED)
+		used = read_table(payload, size, mode, lengths);
+	if (mode != HUFFMAN_TABLE_PREDEFINED && used != (size_t)-1)
+		decoder = huffman_table_decoder(lengths);
+	if (decoder && (header[0] & ~HUFFMAN_TABLE_MASK) ==
+		HUFFMAN_BLOCK_HUFFMAN4)
+		ok = huffman_decode4(decoder, payload + used, size - used, out,
+			raw_size);
+	else
+		ok = decoder && huffman_decode(decoder, payload + used,
+			size - used, out, raw_size);
+	if (!table)
+		huffman_table_clear(&local);
+	return (ok);
+}
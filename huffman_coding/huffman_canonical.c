@@ -0,0 +1,46 @@
+#include "huffman.h"
+
+/**
+ * huffman_canonical_codes - Assigns canonical Huffman codes from code
+ * lengths
+ * @lengths: Code length of each symbol, 0 for symbols without a code
+ * @size: Number of symbols
+ * @codes: Table of @size codes to fill in, indexed by symbol
+ *
+ * Description: Codes of the same length are consecutive integers in the
+ * order of the symbols, and each length starts where the shorter ones
+ * left off. The lengths are then all a decoder needs to rebuild the codes.
+ *
+ * Return: 1 on success, 0 if a length exceeds HUFFMAN_MAX_CODE_LENGTH or
+ * if the lengths are too short to make a prefix code
+ */
+int huffman_canonical_codes(const unsigned char *lengths, size_t size,
+		huffman_code_t *codes)
+{
+	size_t count[HUFFMAN_MAX_CODE_LENGTH + 1] = {0}, i;
+	unsigned long next[HUFFMAN_MAX_CODE_LENGTH + 1], code = 0;
+	unsigned int length;
+
+	if (!lengths || !codes)
+		return (0);
+	for (i = 0; i < size; i++)
+	{
+		if (lengths[i] > HUFFMAN_MAX_CODE_LENGTH)
+			return (0);
+		count[lengths[i]]++;
+	}
+	count[0] = 0;
+	for (length = 1; length <= HUFFMAN_MAX_CODE_LENGTH; length++)
+	{
+		code = (code + count[length - 1]) << 1;
+		next[length] = code;
+		if (code + count[length] > 1UL << length)
+			return (0);
+	}
+	for (i = 0; i < size; i++)
+	{
+		codes[i].length = lengths[i];
+		codes[i].bits = lengths[i] ? next[lengths[i]]++ : 0;
+	}
+	return (1);
+}
@@ -0,0 +1,224 @@
+#include "huffman.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * radix_sort - Sorts symbols by frequency
+ * @freq: Array of frequencies, indexed by symbol
+ * @order: Symbols to sort, sorted on return
+ * @tmp: Buffer of the same size as @order
+ * @size: Number of symbols to sort
+ *
+ * Description: Least significant digit first, one byte per pass. The
+ * counts of all the passes are taken in a single read of the input, and
+ * passes where every frequency has the same byte are skipped, so small
+ * frequencies only take one or two passes. The sort is stable, symbols
+ * of equal frequency stay in increasing order.
+ */
+static void radix_sort(const size_t *freq, size_t *order, size_t *tmp,
+		size_t size)
+{
+	size_t counts[sizeof(size_t)][256], *src = order, *dst = tmp, *swap;
+	size_t *digit, i, pass, sum, count;
+	unsigned int shift;
+
+	memset(counts, 0, sizeof(counts));
+	for (i = 0; i < size; i++)
+		for (pass = 0; pass < sizeof(size_t); pass++)
+			counts[pass][freq[order[i]] >> (pass * 8) & 0xff]++;
+	for (pass = 0; pass < sizeof(size_t); pass++)
+	{
+		shift = pass * 8;
+		digit = counts[pass];
+		if (digit[freq[src[0]] >> shift & 0xff] == size)
+			continue;
+		for (i = 0, sum = 0; i < 256; i++)
+		{
+			count = digit[i];
+			digit[i] = sum;
+			sum += count;
+		}
+		for (i = 0; i < size; i++)
+			dst[digit[freq[src[i]] >> shift & 0xff]++] = src[i];
+		swap = src;
+		src = dst;
+		dst = swap;
+	}
+	if (src != order)
+		memcpy(order, src, sizeof(*order) * size);
+}
+
+/**
+ * two_queue_merge - Builds a Huffman tree from leaves sorted by frequency
+ * @freq: Array of frequencies, indexed by symbol
+ * @order: The m symbols to build the tree of, sorted by frequency
+ * @m: Number of symbols, at least 2
+ * @leaf_parent: Receives the merged node each leaf is a child of
+ * @weight: Buffer for the weights of the m - 1 merged nodes
+ * @parent: Receives the parent of each merged node
+ *
+ * Description: Merged nodes are created in increasing order of weight,
+ * so they form a second sorted queue, and the two lightest nodes are
+ * always at the heads of the two queues. On ties, leaves are taken
+ * first.
+ */
+static void two_queue_merge(const size_t *freq, const size_t *order,
+		size_t m, size_t *leaf_parent, size_t *weight, size_t *parent)
+{
+	size_t leaf = 0, node = 0, next, k;
+
+	for (next = 0; next < m - 1; next++)
+	{
+		weight[next] = 0;
+		for (k = 0; k < 2; k++)
+		{
+			if (leaf < m && (node == next ||
+				freq[order[leaf]] <= weight[node]))
+			{
+				weight[next] += freq[order[leaf]];
+				leaf_parent[leaf++] = next;
+			}
+			else
+			{
+				weight[next] += weight[node];
+				parent[node++] = next;
+			}
+		}
+	}
+}
+
+/**
+ * package_merge - Computes optimal code lengths no longer than a limit
+ * @freq: Array of frequencies, indexed by symbol
+ * @order: The m symbols to compute the lengths of, sorted by frequency
+ * @m: Number of symbols, at least 2 and at most 2^@max_length
+ * @max_length: Longest code length allowed
+ * @lengths: Receives the code length of each symbol
+ *
+ * Description: Package-merge builds one list per level, from the deepest
+ * up: the leaves, merged with the pairs of items of the level below. The
+ * 2m - 2 lightest items of the top list make the optimal code. Leaves
+ * being sorted, the leaves taken at a level are always the lightest ones,
+ * and the packages taken are the first items of the level below, so it
+ * is enough to keep which items of each list are leaves, then count how
+ * many leaves are taken at each level on the way down. A leaf's length
+ * is the number of levels it is taken at.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int package_merge(const size_t *freq, const size_t *order, size_t m,
+		unsigned int max_length, unsigned char *lengths)
+{
+	size_t *prev, *cur, *swap, *sizes, leaf, pkg, n, take, below, i;
+	unsigned char *is_leaf, *leaves;
+	unsigned int level;
+
+	prev = malloc(sizeof(*prev) * (m * 4 + max_length));
+	is_leaf = malloc(m * 2 * max_length);
+	if (!prev || !is_leaf)
+	{
+		free(prev);
+		free(is_leaf);
+		return (0);
+	}
+	cur = prev + m * 2;
+	sizes = cur + m * 2;
+	for (i = 0; i < m; i++)
+	{
+		prev[i] = freq[order[i]];
+		is_leaf[(max_length - 1) * m * 2 + i] = 1;
+	}
+	sizes[max_length - 1] = m;
+	for (level = max_length - 1; level-- > 0;)
+	{
+		below = sizes[level + 1];
+		leaves = is_leaf + level * m * 2;
+		for (leaf = 0, pkg = 0, n = 0; leaf < m || pkg + 1 < below; n++)
+		{
+			leaves[n] = pkg + 1 >= below || (leaf < m &&
+				freq[order[leaf]] <= prev[pkg] + prev[pkg + 1]);
+			cur[n] = leaves[n] ? freq[order[leaf++]] :
+				prev[pkg] + prev[pkg + 1];
+			pkg += leaves[n] ? 0 : 2;
+		}
+		sizes[level] = n;
+		swap = prev;
+		prev = cur;
+		cur = swap;
+	}
+	for (i = 0; i < m; i++)
+		lengths[order[i]] = 0;
+	for (level = 0, take = m * 2 - 2; level < max_length; level++)
+	{
+		for (i = 0, leaf = 0; i < take; i++)
+			leaf += is_leaf[level * m * 2 + i];
+		for (i = 0; i < leaf; i++)
+			lengths[order[i]]++;
+		take = (take - leaf) * 2;
+	}
+	free(prev < cur ? prev : cur);
+	free(is_leaf);
+	return (1);
+}
+
+/**
+ * huffman_code_lengths - Computes the Huffman code length of each symbol
+ * in linear time
+ * @freq: Array of frequencies, indexed by symbol
+ * @size: Number of symbols
+ * @max_length: Longest code length allowed, 0 for no limit
+ * @lengths: Receives the code length of each symbol, 0 for symbols of
+ *   frequency 0, which get no code
+ *
+ * Description: The symbols are radix sorted by frequency, then the tree
+ * is built by the two-queue method, without any comparison function or
+ * heap. Only the depths of the nodes are kept, they are computed from
+ * the root down since a parent is always created after its children.
+ * The lengths are those of the tree built by huffman_tree.
+ * When that tree is deeper than @max_length, the lengths are recomputed
+ * by package-merge, which gives the optimal lengths within the limit.
+ *
+ * Return: 1 on success, 0 on failure or if there are more than
+ * 2^@max_length symbols
+ */
+int huffman_code_lengths(const size_t *freq, size_t size,
+		unsigned int max_length, unsigned char *lengths)
+{
+	size_t *order, *tmp, *leaf_parent, *weight, *parent, m = 0, i;
+	int ok = 1;
+
+	if (!freq || !lengths)
+		return (0);
+	memset(lengths, 0, size);
+	order = malloc(sizeof(*order) * size * 5);
+	if (!order)
+		return (!size);
+	for (i = 0; i < size; i++)
+		if (freq[i])
+			order[m++] = i;
+	tmp = order + m;
+	leaf_parent = tmp + m;
+	weight = leaf_parent + m;
+	parent = weight + m;
+	if (m == 1)
+		lengths[order[0]] = 1;
+	if (max_length && max_length < sizeof(size_t) * 8 &&
+		m > (size_t)1 << max_length)
+		ok = 0;
+	if (ok && m > 1)
+	{
+		radix_sort(freq, order, tmp, m);
+		two_queue_merge(freq, order, m, leaf_parent, weight, parent);
+		/* weight is reused for the depths */
+		weight[m - 2] = 0;
+		for (i = m - 2; i-- > 0;)
+			weight[i] = weight[parent[i]] + 1;
+		for (i = 0; i < m; i++)
+			lengths[order[i]] = weight[leaf_parent[i]] + 1;
+		/* The rarest symbol is always among the deepest */
+		if (max_length && lengths[order[0]] > max_length)
+			ok = package_merge(freq, order, m, max_length, lengths);
+	}
+	free(order);
+	return (ok);
+}
@@ -0,0 +1,61 @@
+#include "huffman.h"
+#include <string.h>
+
+/**
+ * assign_codes - Gives their codes to the leaves of a Huffman subtree
+ * @node: Root of the subtree
+ * @bits: Code of @node
+ * @length: Number of bits of the code of @node
+ * @codes: Table of the codes, indexed by symbol
+ * @size: Number of entries of @codes
+ *
+ * Return: 1 on success, 0 if a code doesn't fit in an unsigned long or a
+ * symbol has no entry in @codes
+ */
+static int assign_codes(const binary_tree_node_t *node, unsigned long bits,
+		unsigned int length, huffman_code_t *codes, size_t size)
+{
+	huffman_symbol_t symbol;
+
+	if (!node->left && !node->right)
+	{
+		symbol = ((symbol_t *)node->data)->data;
+		if (symbol >= size)
+			return (0);
+		codes[symbol].bits = bits;
+		codes[symbol].length = length;
+		return (1);
+	}
+	if (length == sizeof(bits) * 8)
+		return (0);
+	if (node->left &&
+		!assign_codes(node->left, bits << 1, length + 1, codes, size))
+		return (0);
+	if (node->right && !assign_codes(node->right, bits << 1 | 1,
+		length + 1, codes, size))
+		return (0);
+	return (1);
+}
+
+/**
+ * huffman_codes - Builds the code table of a Huffman tree
+ * @root: Pointer to the root of the tree
+ * @codes: Table of codes to fill in, indexed by symbol
+ * @size: Number of entries of @codes, HUFFMAN_NB_SYMBOLS for bytes, more
+ *   than the largest symbol of the tree
+ *
+ * Description: Encoding then takes a single lookup per symbol instead of
+ * a walk in the tree. Symbols not in the tree get a length of 0. A tree
+ * made of a single leaf gives it a 1-bit code.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_codes(const binary_tree_node_t *root, huffman_code_t *codes,
+		size_t size)
+{
+	if (!root || !codes)
+		return (0);
+	memset(codes, 0, sizeof(*codes) * size);
+	return (assign_codes(root, 0, !root->left && !root->right, codes,
+		size));
+}
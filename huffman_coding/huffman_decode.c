@@ -0,0 +1,51 @@
+#include "huffman_bits.h"
+
+/**
+ * huffman_decode - Decodes bytes encoded with canonical Huffman codes
+ * @decoder: Pointer to the decoding tables of the codes
+ * @in: Encoded bits, most significant first
+ * @in_size: Number of bytes of @in
+ * @out: Buffer receiving the decoded bytes
+ * @out_size: Number of bytes to decode
+ *
+ * Description: Each symbol takes one table lookup, two for codes longer
+ * than HUFFMAN_TABLE_BITS. Away from the ends of the buffers, a refill
+ * leaves at least 56 bits, enough for 56 / max_length codes that are then
+ * decoded without any bounds check. A code no symbol has decodes with a
+ * length of 0, which is only checked once the loop is over. The ends of
+ * the buffers are decoded one checked symbol at a time.
+ *
+ * Return: 1 on success, 0 if the input is invalid or too short
+ */
+int huffman_decode(const huffman_decoder_t *decoder, const unsigned char *in,
+		size_t in_size, unsigned char *out, size_t out_size)
+{
+	bit_reader_t reader;
+	unsigned char *end = out + out_size;
+	unsigned int per_refill, k, length, invalid = 0;
+	uint32_t entry;
+
+	if (!decoder || !in || !out || !decoder->max_length)
+		return (!out_size);
+	reader.in = in;
+	reader.end = in + in_size;
+	reader.buf = 0;
+	reader.count = 0;
+	per_refill = 56 / decoder->max_length;
+	while ((size_t)(end - out) >= per_refill && reader.end - reader.in >= 8)
+	{
+		bit_refill(&reader);
+		for (k = 0; k < per_refill; k++)
+		{
+			entry = huffman_decode_entry(decoder, reader.buf);
+			length = entry & 0x3f;
+			invalid |= !length;
+			*out++ = (unsigned char)(entry >> 8);
+			reader.buf <<= length;
+			reader.count -= length;
+		}
+	}
+	if (invalid)
+		return (0);
+	return (huffman_decode_checked(decoder, &reader, out, end));
+}
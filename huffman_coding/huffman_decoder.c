@@ -0,0 +1,133 @@
+#include "huffman_bits.h"
+#include <stdlib.h>
+
+/**
+ * fill_entries - Fills the entries of a table a code maps to
+ * @table: Table to fill
+ * @code: Bits of the code, from the bits the table is indexed by
+ * @length: Number of bits of @code
+ * @bits: Number of bits the table is indexed by, at least @length
+ * @entry: Entry to store
+ *
+ * Description: A code shorter than the index owns every index it is a
+ * prefix of, whatever the bits that follow it
+ */
+static void fill_entries(uint32_t *table, unsigned long code,
+		unsigned int length, unsigned int bits, uint32_t entry)
+{
+	size_t i, first = code << (bits - length);
+
+	for (i = 0; i < 1UL << (bits - length); i++)
+		table[first + i] = entry;
+}
+
+/**
+ * link_sub_tables - Sizes the sub-tables of the codes longer than the
+ * primary table, and links them to it
+ * @decoder: Pointer to the decoder, with a zeroed primary table
+ * @codes: Canonical codes of the symbols
+ * @size: Number of symbols
+ *
+ * Description: A sub-table is indexed by as many bits as the longest code
+ * of its prefix needs
+ *
+ * Return: Total number of entries of the sub-tables
+ */
+static size_t link_sub_tables(huffman_decoder_t *decoder,
+		const huffman_code_t *codes, size_t size)
+{
+	uint32_t *entry;
+	size_t i, offset = 0, prefix;
+	unsigned int extra;
+
+	for (i = 0; i < size; i++)
+	{
+		if (codes[i].length <= HUFFMAN_TABLE_BITS)
+			continue;
+		extra = codes[i].length - HUFFMAN_TABLE_BITS;
+		entry = &decoder->primary[codes[i].bits >> extra];
+		if ((*entry & 0x7f) < extra)
+			*entry = HUFFMAN_LINK(0, extra);
+	}
+	for (prefix = 0; prefix < 1 << HUFFMAN_TABLE_BITS; prefix++)
+	{
+		entry = &decoder->primary[prefix];
+		if (!*entry)
+			continue;
+		*entry |= offset << 8;
+		offset += 1UL << (*entry & 0x7f);
+	}
+	return (offset);
+}
+
+/**
+ * huffman_decoder_create - Builds the decoding tables of canonical Huffman
+ * codes
+ * @lengths: Code length of each symbol, 0 for symbols without a code
+ * @size: Number of symbols, at most HUFFMAN_MAX_SYMBOLS
+ *
+ * Return: Pointer to the decoder, or NULL on failure or if the lengths
+ * don't make a prefix code
+ */
+huffman_decoder_t *huffman_decoder_create(const unsigned char *lengths,
+		size_t size)
+{
+	huffman_decoder_t *decoder;
+	huffman_code_t *codes, *code;
+	size_t i, nb_secondary;
+	uint32_t link;
+	unsigned int extra;
+
+	if (size > HUFFMAN_MAX_SYMBOLS)
+		return (NULL);
+	decoder = calloc(1, sizeof(*decoder));
+	codes = malloc(sizeof(*codes) * (size + 1));
+	if (!decoder || !codes ||
+		!huffman_canonical_codes(lengths, size, codes))
+	{
+		free(decoder);
+		free(codes);
+		return (NULL);
+	}
+	nb_secondary = link_sub_tables(decoder, codes, size);
+	decoder->secondary = calloc(nb_secondary + 1, sizeof(uint32_t));
+	for (i = 0; decoder->secondary && i < size; i++)
+	{
+		code = &codes[i];
+		if (code->length > decoder->max_length)
+			decoder->max_length = code->length;
+		if (!code->length || code->length <= HUFFMAN_TABLE_BITS)
+		{
+			if (code->length)
+				fill_entries(decoder->primary, code->bits,
+					code->length, HUFFMAN_TABLE_BITS,
+					HUFFMAN_ENTRY(i, code->length));
+			continue;
+		}
+		extra = code->length - HUFFMAN_TABLE_BITS;
+		link = decoder->primary[code->bits >> extra];
+		fill_entries(decoder->secondary + (link >> 8),
+			code->bits & ((1UL << extra) - 1), extra, link & 0x7f,
+			HUFFMAN_ENTRY(i, code->length));
+	}
+	free(codes);
+	if (!decoder->secondary)
+	{
+		free(decoder);
+		return (NULL);
+	}
+	return (decoder);
+}
+
+/**
+ * huffman_decoder_delete - Deallocates a decoder
+ * @decoder: Pointer to the decoder to delete
+ */
+void huffman_decoder_delete(huffman_decoder_t *decoder)
+{
+	if (!decoder)
+		return;
+
+	free(decoder->secondary);
+	free(decoder);
+}
@@ -0,0 +1,40 @@
+#include "huffman_bits.h"
+
+/**
+ * huffman_encode - Encodes bytes with Huffman codes
+ * @codes: Table of the codes, indexed by byte, as filled in by
+ *   huffman_canonical_codes or huffman_codes
+ * @in: Bytes to encode, each must have a code
+ * @in_size: Number of bytes to encode
+ * @out: Buffer receiving the encoded bits, most significant first, the
+ *   last byte padded with zeros
+ * @out_size: Size of @out
+ *
+ * Return: Number of bytes written, or 0 if @out is too small or a byte
+ * has no code
+ */
+size_t huffman_encode(const huffman_code_t *codes, const unsigned char *in,
+		size_t in_size, unsigned char *out, size_t out_size)
+{
+	bit_writer_t writer;
+	size_t i;
+
+	if (!codes || !in || !out)
+		return (0);
+	writer.out = out;
+	writer.end = out + out_size;
+	writer.acc = 0;
+	writer.count = 0;
+	writer.overflow = 0;
+	for (i = 0; i < in_size && !writer.overflow; i++)
+	{
+		if (!codes[in[i]].length ||
+			codes[in[i]].length > HUFFMAN_MAX_CODE_LENGTH)
+			return (0);
+		bit_write(&writer, codes[in[i]].bits, codes[in[i]].length);
+	}
+	bit_flush(&writer);
+	if (writer.overflow)
+		return (0);
+	return (writer.out - out);
+}
@@ -6,84 +6,56 @@
  * huffman_extract_and_insert - Extracts two nodes and inserts a new one
  * @priority_queue: Pointer to the priority queue
  *
+ * Description: The queue holds nested nodes, each storing a symbol. The
+ * two extracted nested nodes become the children of a new nested node,
+ * whose symbol has the sum of their frequencies and is marked internal.
+ *
  * Return: 1 on success, 0 on failure
  */
 int huffman_extract_and_insert(heap_t *priority_queue)
 {
-	binary_tree_node_t *node1, *node2, *new_node;
 	binary_tree_node_t *nested1, *nested2, *new_nested;
 	symbol_t *symbol1, *symbol2, *new_symbol;
 
 	if (!priority_queue || !priority_queue->root || priority_queue->size < 2)
 		return (0);
 
-	/* Extract the two nodes with the lowest frequencies */
-	node1 = heap_extract(priority_queue);
-	if (!node1)
-		return (0);
-
-	node2 = heap_extract(priority_queue);
-	if (!node2)
-	{
-		heap_insert(priority_queue, node1);
-		return (0);
-	}
-
-	/* Get the nested nodes and symbols */
-	nested1 = (binary_tree_node_t *)(node1->data);
-	nested2 = (binary_tree_node_t *)(node2->data);
+	/* Extract the two nested nodes with the lowest frequencies */
+	nested1 = heap_extract(priority_queue);
+	nested2 = heap_extract(priority_queue);
 	symbol1 = (symbol_t *)(nested1->data);
 	symbol2 = (symbol_t *)(nested2->data);
 
-	/* Create a new symbol with the sum of frequencies */
-	new_symbol = symbol_create(-1, symbol1->freq + symbol2->freq);
-	if (!new_symbol)
-	{
-		heap_insert(priority_queue, node1);
-		heap_insert(priority_queue, node2);
-		return (0);
-	}
-
-	/* Create a new nested node with the new symbol */
-	new_nested = binary_tree_node(NULL, new_symbol);
+	/* Create a new nested node with the sum of frequencies */
+	new_symbol = symbol_create(0, symbol1->freq + symbol2->freq);
+	if (new_symbol)
+		new_symbol->internal = 1;
+	new_nested = new_symbol ? binary_tree_node(NULL, new_symbol) : NULL;
 	if (!new_nested)
 	{
 		free(new_symbol);
-		heap_insert(priority_queue, node1);
-		heap_insert(priority_queue, node2);
+		heap_insert(priority_queue, nested1);
+		heap_insert(priority_queue, nested2);
 		return (0);
 	}
 
 	/* Set the extracted nested nodes as children of the new nested node */
 	new_nested->left = nested1;
 	new_nested->right = nested2;
+	nested1->parent = new_nested;
+	nested2->parent = new_nested;
 
-	/* Create a new node for the priority queue */
-	new_node = binary_tree_node(NULL, new_nested);
-	if (!new_node)
+	/* Insert the new nested node into the priority queue */
+	if (!heap_insert(priority_queue, new_nested))
 	{
+		nested1->parent = NULL;
+		nested2->parent = NULL;
 		free(new_symbol);
 		free(new_nested);
-		heap_insert(priority_queue, node1);
-		heap_insert(priority_queue, node2);
+		heap_insert(priority_queue, nested1);
+		heap_insert(priority_queue, nested2);
 		return (0);
 	}
 
-	/* Insert the new node into the priority queue */
-	if (!heap_insert(priority_queue, new_node))
-	{
-		free(new_symbol);
-		free(new_nested);
-		free(new_node);
-		heap_insert(priority_queue, node1);
-		heap_insert(priority_queue, node2);
-		return (0);
-	}
-
-	/* Free the old nodes from the priority queue */
-	free(node1);
-	free(node2);
-
 	return (1);
 }
-
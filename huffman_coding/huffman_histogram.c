@@ -0,0 +1,102 @@
+#include "huffman.h"
+#include <string.h>
+
+#define HISTOGRAM_TABLES 8
+#define HISTOGRAM_CHUNK ((size_t)1 << 30)
+
+/**
+ * histogram_chunk - Counts the bytes of a buffer in interleaved tables
+ * @buf: Bytes to count
+ * @len: Number of bytes, less than 2^32
+ * @counts: Tables to count in, zeroed by the caller
+ *
+ * Description: Consecutive bytes go to different tables, so that a run of
+ * the same byte doesn't make each increment wait for the store of the one
+ * before. Bytes are loaded 8 at a time.
+ */
+static void histogram_chunk(const unsigned char *buf, size_t len,
+		uint32_t counts[HISTOGRAM_TABLES][HUFFMAN_NB_SYMBOLS])
+{
+	uint64_t word;
+	size_t i = 0;
+
+	for (; i + 8 <= len; i += 8)
+	{
+		memcpy(&word, buf + i, sizeof(word));
+		counts[0][word & 0xff]++;
+		counts[1][word >> 8 & 0xff]++;
+		counts[2][word >> 16 & 0xff]++;
+		counts[3][word >> 24 & 0xff]++;
+		counts[4][word >> 32 & 0xff]++;
+		counts[5][word >> 40 & 0xff]++;
+		counts[6][word >> 48 & 0xff]++;
+		counts[7][word >> 56]++;
+	}
+	for (; i < len; i++)
+		counts[i % HISTOGRAM_TABLES][buf[i]]++;
+}
+
+/**
+ * huffman_histogram - Counts the occurrences of each byte of a buffer
+ * @buf: Bytes to count
+ * @len: Number of bytes
+ * @freq: Table of HUFFMAN_NB_SYMBOLS frequencies the counts are added to,
+ *   so that several buffers can be counted together
+ *
+ * Description: Counting is done in interleaved 32-bit tables, merged into
+ * @freq every 2^30 bytes
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_histogram(const unsigned char *buf, size_t len, size_t *freq)
+{
+	uint32_t counts[HISTOGRAM_TABLES][HUFFMAN_NB_SYMBOLS];
+	size_t chunk, t, i;
+
+	if ((!buf && len) || !freq)
+		return (0);
+	while (len)
+	{
+		chunk = len < HISTOGRAM_CHUNK ? len : HISTOGRAM_CHUNK;
+		memset(counts, 0, sizeof(counts));
+		histogram_chunk(buf, chunk, counts);
+		for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+			for (t = 0; t < HISTOGRAM_TABLES; t++)
+				freq[i] += counts[t][i];
+		buf += chunk;
+		len -= chunk;
+	}
+	return (1);
+}
+
+/**
+ * huffman_histogram_blocks - Counts the occurrences of each byte in each
+ * block of a buffer
+ * @buf: Bytes to count
+ * @len: Number of bytes
+ * @block_size: Size of the blocks, the last one may be shorter
+ * @freq: Tables of HUFFMAN_NB_SYMBOLS frequencies, one per block, that
+ *   are overwritten
+ *
+ * Description: The buffer is read once, the counts of each block being
+ * merged as soon as the block ends
+ *
+ * Return: Number of blocks, or 0 on failure
+ */
+size_t huffman_histogram_blocks(const unsigned char *buf, size_t len,
+		size_t block_size, size_t *freq)
+{
+	size_t nb_blocks = 0, size;
+
+	if (!buf || !freq || !block_size)
+		return (0);
+	for (; len; nb_blocks++, freq += HUFFMAN_NB_SYMBOLS)
+	{
+		size = len < block_size ? len : block_size;
+		memset(freq, 0, sizeof(*freq) * HUFFMAN_NB_SYMBOLS);
+		huffman_histogram(buf, size, freq);
+		buf += size;
+		len -= size;
+	}
+	return (nb_blocks);
+}
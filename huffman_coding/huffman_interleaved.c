@@ -0,0 +1,162 @@
+#include "huffman_bits.h"
+
+/**
+ * huffman_encode4 - Encodes bytes with Huffman codes, in
+ * HUFFMAN_NB_STREAMS streams
+ * @codes: Table of the codes, indexed by byte
+ * @in: Bytes to encode, each must have a code
+ * @in_size: Number of bytes to encode
+ * @out: Buffer receiving the jump table and the streams
+ * @out_size: Size of @out
+ *
+ * Description: The input is cut into HUFFMAN_NB_STREAMS segments of
+ * (@in_size + 3) / 4 bytes, the last one taking what is left, and each
+ * segment is encoded as by huffman_encode. The jump table gives the size
+ * of each stream but the last one, as big-endian 32-bit integers.
+ *
+ * Return: Number of bytes written, or 0 if @out is too small or a byte
+ * has no code
+ */
+size_t huffman_encode4(const huffman_code_t *codes, const unsigned char *in,
+		size_t in_size, unsigned char *out, size_t out_size)
+{
+	size_t pos = HUFFMAN_JUMP_TABLE_SIZE, start = 0, segment, len, size;
+	unsigned int s;
+
+	if (!codes || !in || !out || out_size < HUFFMAN_JUMP_TABLE_SIZE)
+		return (0);
+	segment = (in_size + HUFFMAN_NB_STREAMS - 1) / HUFFMAN_NB_STREAMS;
+	for (s = 0; s < HUFFMAN_NB_STREAMS; s++)
+	{
+		len = in_size - start < segment ? in_size - start : segment;
+		size = huffman_encode(codes, in + start, len, out + pos,
+			out_size - pos);
+		if (!size && len)
+			return (0);
+		if (s < HUFFMAN_NB_STREAMS - 1)
+			store_be32(out + s * 4, size);
+		start += len;
+		pos += size;
+	}
+	return (pos);
+}
+
+/**
+ * decode_streams - Decodes the streams side by side while none of them is
+ * near the end of its buffers
+ * @decoder: Pointer to the decoding tables of the codes
+ * @readers: Bit readers of the streams
+ * @outs: Where the next byte of each stream goes
+ * @ends: End of the output of each stream
+ *
+ * Description: Each step refills the four bit buffers, then decodes
+ * 56 / max_length symbols from each, one stream after the other. The
+ * lookups of the four streams don't depend on each other, so they
+ * overlap in the pipeline, where a single stream waits for each length
+ * before it can shift its buffer.
+ *
+ * Return: 1 if no invalid code was found, 0 otherwise
+ */
+static int decode_streams(const huffman_decoder_t *decoder,
+		bit_reader_t *readers, unsigned char **outs,
+		unsigned char **ends)
+{
+	bit_reader_t r0 = readers[0], r1 = readers[1], r2 = readers[2];
+	bit_reader_t r3 = readers[3];
+	unsigned char *o0 = outs[0], *o1 = outs[1], *o2 = outs[2];
+	unsigned char *o3 = outs[3];
+	unsigned int per_refill = 56 / decoder->max_length, k, invalid = 0;
+	uint32_t e0, e1, e2, e3;
+
+	while ((size_t)(ends[3] - o3) >= per_refill &&
+		r0.end - r0.in >= 8 && r1.end - r1.in >= 8 &&
+		r2.end - r2.in >= 8 && r3.end - r3.in >= 8)
+	{
+		bit_refill(&r0);
+		bit_refill(&r1);
+		bit_refill(&r2);
+		bit_refill(&r3);
+		for (k = 0; k < per_refill; k++)
+		{
+			e0 = huffman_decode_entry(decoder, r0.buf);
+			e1 = huffman_decode_entry(decoder, r1.buf);
+			e2 = huffman_decode_entry(decoder, r2.buf);
+			e3 = huffman_decode_entry(decoder, r3.buf);
+			invalid |= !(e0 & 0x3f) | !(e1 & 0x3f) | !(e2 & 0x3f) |
+				!(e3 & 0x3f);
+			*o0++ = (unsigned char)(e0 >> 8);
+			*o1++ = (unsigned char)(e1 >> 8);
+			*o2++ = (unsigned char)(e2 >> 8);
+			*o3++ = (unsigned char)(e3 >> 8);
+			r0.buf <<= e0 & 0x3f;
+			r1.buf <<= e1 & 0x3f;
+			r2.buf <<= e2 & 0x3f;
+			r3.buf <<= e3 & 0x3f;
+			r0.count -= e0 & 0x3f;
+			r1.count -= e1 & 0x3f;
+			r2.count -= e2 & 0x3f;
+			r3.count -= e3 & 0x3f;
+		}
+	}
+	readers[0] = r0;
+	readers[1] = r1;
+	readers[2] = r2;
+	readers[3] = r3;
+	outs[0] = o0;
+	outs[1] = o1;
+	outs[2] = o2;
+	outs[3] = o3;
+	return (!invalid);
+}
+
+/**
+ * huffman_decode4 - Decodes bytes encoded by huffman_encode4
+ * @decoder: Pointer to the decoding tables of the codes
+ * @in: Jump table and streams
+ * @in_size: Number of bytes of @in
+ * @out: Buffer receiving the decoded bytes
+ * @out_size: Number of bytes to decode
+ *
+ * Description: The streams are decoded side by side, four bit buffers
+ * being in flight at once. The last segment is never longer than the
+ * others, so the loop only has to watch its output. The ends of the
+ * streams are decoded one checked symbol at a time.
+ *
+ * Return: 1 on success, 0 if the input is invalid or too short
+ */
+int huffman_decode4(const huffman_decoder_t *decoder, const unsigned char *in,
+		size_t in_size, unsigned char *out, size_t out_size)
+{
+	bit_reader_t readers[HUFFMAN_NB_STREAMS];
+	unsigned char *outs[HUFFMAN_NB_STREAMS], *ends[HUFFMAN_NB_STREAMS];
+	size_t pos = HUFFMAN_JUMP_TABLE_SIZE, size, start = 0, segment;
+	unsigned int s;
+
+	if (!decoder || !in || !out || !decoder->max_length ||
+		in_size < HUFFMAN_JUMP_TABLE_SIZE)
+		return (!out_size);
+	segment = (out_size + HUFFMAN_NB_STREAMS - 1) / HUFFMAN_NB_STREAMS;
+	for (s = 0; s < HUFFMAN_NB_STREAMS; s++)
+	{
+		size = s < HUFFMAN_NB_STREAMS - 1 ? load_be32(in + s * 4) :
+			in_size - pos;
+		if (size > in_size - pos)
+			return (0);
+		readers[s].in = in + pos;
+		readers[s].end = in + pos + size;
+		readers[s].buf = 0;
+		readers[s].count = 0;
+		outs[s] = out + start;
+		start += out_size - start < segment ? out_size - start :
+			segment;
+		ends[s] = out + start;
+		pos += size;
+	}
+	if (!decode_streams(decoder, readers, outs, ends))
+		return (0);
+	for (s = 0; s < HUFFMAN_NB_STREAMS; s++)
+		if (!huffman_decode_checked(decoder, &readers[s], outs[s],
+			ends[s]))
+			return (0);
+	return (1);
+}
@@ -0,0 +1,112 @@
+#include "huffman_stream.h"
+#include <errno.h>
+#include <unistd.h>
+
+/**
+ * huffman_read_full - Reads from a file descriptor until a buffer is full
+ * @fd: File descriptor to read from
+ * @buf: Buffer to fill
+ * @size: Number of bytes to read
+ *
+ * Description: Pipes and sockets return what they have, so reads are
+ * repeated until @size bytes are read or the end of the input is reached
+ *
+ * Return: Number of bytes read, less than @size at the end of the input,
+ * or (size_t)-1 on error
+ */
+size_t huffman_read_full(int fd, void *buf, size_t size)
+{
+	size_t done = 0;
+	ssize_t n;
+
+	while (done < size)
+	{
+		n = read(fd, (char *)buf + done, size - done);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			return ((size_t)-1);
+		if (n == 0)
+			break;
+		done += n;
+	}
+	return (done);
+}
+
+/**
+ * huffman_read_some - Reads what a file descriptor has, waiting only if
+ * it has nothing yet
+ * @fd: File descriptor to read from
+ * @buf: Buffer to fill
+ * @size: Size of @buf
+ *
+ * Return: Number of bytes read, 0 at the end of the input, or (size_t)-1
+ * on error
+ */
+size_t huffman_read_some(int fd, void *buf, size_t size)
+{
+	ssize_t n;
+
+	do {
+		n = read(fd, buf, size);
+	} while (n < 0 && errno == EINTR);
+	return (n < 0 ? (size_t)-1 : (size_t)n);
+}
+
+/**
+ * huffman_write_full - Writes a whole buffer to a file descriptor
+ * @fd: File descriptor to write to
+ * @buf: Buffer to write
+ * @size: Number of bytes to write
+ *
+ * Return: 1 on success, 0 on error
+ */
+int huffman_write_full(int fd, const void *buf, size_t size)
+{
+	size_t done = 0;
+	ssize_t n;
+
+	while (done < size)
+	{
+		n = write(fd, (const char *)buf + done, size - done);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return (0);
+		done += n;
+	}
+	return (1);
+}
+
+/**
+ * huffman_pread_full - Reads from a given offset of a file until a buffer
+ * is full
+ * @fd: File descriptor to read from, which must be seekable
+ * @buf: Buffer to fill
+ * @size: Number of bytes to read
+ * @offset: Offset in the file to read from
+ *
+ * Description: The offset of the file descriptor is left unchanged, so
+ * several threads can read from it at once
+ *
+ * Return: Number of bytes read, less than @size at the end of the file,
+ * or (size_t)-1 on error
+ */
+size_t huffman_pread_full(int fd, void *buf, size_t size, off_t offset)
+{
+	size_t done = 0;
+	ssize_t n;
+
+	while (done < size)
+	{
+		n = pread(fd, (char *)buf + done, size - done, offset + done);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			return ((size_t)-1);
+		if (n == 0)
+			break;
+		done += n;
+	}
+	return (done);
+}
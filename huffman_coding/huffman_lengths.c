@@ -0,0 +1,165 @@
+#include "huffman_stream.h"
+#include <string.h>
+
+/*
+ * Code lengths are written as 4-bit values, from symbol 0 to the last one:
+ *   0 to RLE_MAX_LENGTH: the length of the next symbol
+ *   RLE_REPEAT: the length before repeated 3 to 6 times, 2 more bits
+ *   RLE_ZEROS: 3 to 10 lengths of 0, 3 more bits
+ *   RLE_LONG_ZEROS: 11 to 138 lengths of 0, 7 more bits
+ */
+#define RLE_MAX_LENGTH 12
+#define RLE_REPEAT 13
+#define RLE_ZEROS 14
+#define RLE_LONG_ZEROS 15
+
+/**
+ * write_run - Writes a run of the same code length
+ * @writer: Pointer to the bit writer
+ * @length: The code length
+ * @run: Number of symbols with that length, the first one included
+ */
+static void write_run(bit_writer_t *writer, unsigned int length, size_t run)
+{
+	size_t n;
+
+	if (length)
+	{
+		bit_write(writer, length, 4);
+		for (run--; run >= 3; run -= n)
+		{
+			n = run < 6 ? run : 6;
+			bit_write(writer, RLE_REPEAT << 2 | (n - 3), 6);
+		}
+	}
+	for (; length == 0 && run >= 3; run -= n)
+	{
+		n = run < 138 ? run : 138;
+		if (n >= 11)
+			bit_write(writer, RLE_LONG_ZEROS << 7 | (n - 11), 11);
+		else
+			bit_write(writer, RLE_ZEROS << 3 | (n - 3), 7);
+	}
+	for (; run > 0; run--)
+		bit_write(writer, length, 4);
+}
+
+/**
+ * huffman_lengths_write - Writes the code lengths of a block, runs of
+ * zeros and of repeated lengths taking a few bits
+ * @lengths: Code length of each of the HUFFMAN_NB_SYMBOLS bytes
+ * @out: Buffer receiving the lengths
+ * @out_size: Size of @out, HUFFMAN_LENGTHS_BOUND is always enough
+ *
+ * Description: Blocks of text use a few dozen bytes, which this writes
+ * in about as many bytes, where 5 bits per byte up to the last one take
+ * about 80
+ *
+ * Return: Number of bytes written, or 0 if a length exceeds
+ * RLE_MAX_LENGTH or @out is too small
+ */
+size_t huffman_lengths_write(const unsigned char *lengths, unsigned char *out,
+		size_t out_size)
+{
+	bit_writer_t writer;
+	size_t i, run;
+
+	writer.out = out;
+	writer.end = out + out_size;
+	writer.acc = 0;
+	writer.count = 0;
+	writer.overflow = 0;
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i += run)
+	{
+		if (lengths[i] > RLE_MAX_LENGTH)
+			return (0);
+		for (run = 1; i + run < HUFFMAN_NB_SYMBOLS &&
+			lengths[i + run] == lengths[i]; run++)
+			;
+		write_run(&writer, lengths[i], run);
+	}
+	bit_flush(&writer);
+	return (writer.overflow ? 0 : (size_t)(writer.out - out));
+}
+
+/**
+ * huffman_lengths_read - Reads code lengths written by
+ * huffman_lengths_write
+ * @in: Payload of the block
+ * @size: Size of the payload
+ * @lengths: Receives the code length of each byte
+ *
+ * Return: Number of bytes read, or 0 if the lengths are invalid
+ */
+size_t huffman_lengths_read(const unsigned char *in, size_t size,
+		unsigned char *lengths)
+{
+	static const unsigned int extra[] = {2, 3, 7}, base[] = {3, 3, 11};
+	bit_reader_t reader;
+	size_t i = 0, run;
+	unsigned int value, bits;
+
+	reader.in = in;
+	reader.end = in + size;
+	reader.buf = 0;
+	reader.count = 0;
+	while (i < HUFFMAN_NB_SYMBOLS)
+	{
+		bit_refill(&reader);
+		value = reader.buf >> 60;
+		bits = 4;
+		if (value > RLE_MAX_LENGTH)
+			bits += extra[value - RLE_REPEAT];
+		if (bits > reader.count || (value == RLE_REPEAT && !i))
+			return (0);
+		run = value > RLE_MAX_LENGTH ? base[value - RLE_REPEAT] +
+			(size_t)(reader.buf << 4 >> (68 - bits)) : 1;
+		reader.buf <<= bits;
+		reader.count -= bits;
+		if (run > HUFFMAN_NB_SYMBOLS - i)
+			return (0);
+		value = value == RLE_REPEAT ? lengths[i - 1] :
+			value > RLE_MAX_LENGTH ? 0 : value;
+		memset(lengths + i, value, run);
+		i += run;
+	}
+	return (reader.in - in - reader.count / 8);
+}
+
+/**
+ * huffman_lengths_read_packed - Reads code lengths stored with
+ * HUFFMAN_LENGTH_BITS bits each
+ * @in: Payload of the block
+ * @size: Size of the payload
+ * @lengths: Receives the code length of each byte
+ *
+ * Description: This is how code lengths were stored before
+ * huffman_lengths_write, which streams may still hold
+ *
+ * Return: Number of bytes read, or 0 if the payload is too short
+ */
+size_t huffman_lengths_read_packed(const unsigned char *in, size_t size,
+		unsigned char *lengths)
+{
+	bit_reader_t reader;
+	unsigned int last, i;
+
+	if (!size)
+		return (0);
+	memset(lengths, 0, HUFFMAN_NB_SYMBOLS);
+	last = in[0];
+	reader.in = in + 1;
+	reader.end = in + size;
+	reader.buf = 0;
+	reader.count = 0;
+	for (i = 0; i <= last; i++)
+	{
+		bit_refill(&reader);
+		if (reader.count < HUFFMAN_LENGTH_BITS)
+			return (0);
+		lengths[i] = reader.buf >> (64 - HUFFMAN_LENGTH_BITS);
+		reader.buf <<= HUFFMAN_LENGTH_BITS;
+		reader.count -= HUFFMAN_LENGTH_BITS;
+	}
+	return (1 + ((last + 1) * HUFFMAN_LENGTH_BITS + 7) / 8);
+}
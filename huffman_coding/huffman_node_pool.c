@@ -0,0 +1,85 @@
+#include "huffman.h"
+#include <stdlib.h>
+
+/**
+ * pool_node_init - Initializes a node of a pool and its symbol
+ * @pool: Pointer to the pool
+ * @index: Index of the node
+ * @data: The symbol, ignored for an internal node
+ * @internal: Set for an internal node
+ * @freq: The frequency
+ */
+static void pool_node_init(huffman_node_pool_t *pool, size_t index,
+		huffman_symbol_t data, int internal, size_t freq)
+{
+	binary_tree_node_t *node = &pool->nodes[index];
+
+	pool->symbols[index].data = data;
+	pool->symbols[index].internal = internal;
+	pool->symbols[index].freq = freq;
+	node->data = &pool->symbols[index];
+	node->left = NULL;
+	node->right = NULL;
+	node->parent = NULL;
+}
+
+/**
+ * huffman_node_pool_init - Allocates the nodes of the Huffman tree of a
+ * set of symbols
+ * @pool: Pointer to the pool to initialize
+ * @data: Array of symbols
+ * @freq: Array of frequencies
+ * @size: Size of the arrays
+ *
+ * Description: The 2 * @size - 1 nodes and their symbols are taken from
+ * a single block, nodes first. The leaf of symbol i is node
+ * @size - 1 + i, and merged nodes are handed out from the end of the
+ * free nodes towards the start, so the root, merged last, is node 0: the
+ * whole tree is deallocated by freeing its root.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_node_pool_init(huffman_node_pool_t *pool, huffman_symbol_t *data,
+		size_t *freq, size_t size)
+{
+	size_t i;
+
+	if (!pool || !data || !freq || !size)
+		return (0);
+	pool->nodes = malloc((sizeof(*pool->nodes) + sizeof(*pool->symbols)) *
+		(size * 2 - 1));
+	if (!pool->nodes)
+		return (0);
+	pool->symbols = (symbol_t *)(pool->nodes + size * 2 - 1);
+	pool->size = size;
+	pool->next = size - 1;
+	for (i = 0; i < size; i++)
+		pool_node_init(pool, size - 1 + i, data[i], 0, freq[i]);
+	return (1);
+}
+
+/**
+ * huffman_node_pool_merge - Merges two nodes of a pool under a new one
+ * @pool: Pointer to the pool
+ * @left: Index of the left child
+ * @right: Index of the right child
+ *
+ * Return: Index of the new node, whose frequency is the sum of its
+ * children's, or HUFFMAN_NO_NODE if the pool has no node left
+ */
+size_t huffman_node_pool_merge(huffman_node_pool_t *pool, size_t left,
+		size_t right)
+{
+	size_t index;
+
+	if (!pool || !pool->next)
+		return (HUFFMAN_NO_NODE);
+	index = --pool->next;
+	pool_node_init(pool, index, 0, 1,
+		pool->symbols[left].freq + pool->symbols[right].freq);
+	pool->nodes[index].left = &pool->nodes[left];
+	pool->nodes[index].right = &pool->nodes[right];
+	pool->nodes[left].parent = &pool->nodes[index];
+	pool->nodes[right].parent = &pool->nodes[index];
+	return (index);
+}
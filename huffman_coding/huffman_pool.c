@@ -0,0 +1,149 @@
+#include "huffman_stream.h"
+#include <stdlib.h>
+
+/**
+ * pool_worker - Processes the jobs of a block pool, in order
+ * @arg: Pointer to the pool
+ *
+ * Return: NULL
+ */
+static void *pool_worker(void *arg)
+{
+	huffman_pool_t *pool = arg;
+	huffman_job_t *job;
+	int ok;
+
+	pthread_mutex_lock(&pool->lock);
+	while (!pool->stop)
+	{
+		if (pool->nb_taken == pool->nb_queued)
+		{
+			pthread_cond_wait(&pool->queued, &pool->lock);
+			continue;
+		}
+		job = &pool->jobs[pool->nb_taken++ % pool->nb_jobs];
+		pthread_mutex_unlock(&pool->lock);
+		ok = pool->work(pool, job);
+		pthread_mutex_lock(&pool->lock);
+		job->state = ok ? HUFFMAN_JOB_DONE : HUFFMAN_JOB_FAILED;
+		pthread_cond_broadcast(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return (NULL);
+}
+
+/**
+ * huffman_pool_create - Starts the threads of a block pool
+ * @nb_threads: Number of worker threads
+ * @work: Function processing a job
+ * @fd: File descriptor @work may read blocks from
+ *
+ * Description: The pool has two slots per thread, so that blocks keep
+ * being processed while a completed one waits for the ones before it
+ *
+ * Return: Pointer to the pool, or NULL on failure
+ */
+huffman_pool_t *huffman_pool_create(size_t nb_threads,
+		int (*work)(const huffman_pool_t *pool, huffman_job_t *job),
+		int fd)
+{
+	huffman_pool_t *pool;
+	size_t i;
+
+	pool = calloc(1, sizeof(*pool));
+	if (!pool)
+		return (NULL);
+	pool->nb_jobs = nb_threads * 2;
+	pool->work = work;
+	pool->fd = fd;
+	pool->jobs = calloc(pool->nb_jobs, sizeof(*pool->jobs));
+	pool->threads = malloc(sizeof(*pool->threads) * nb_threads);
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->queued, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	for (i = 0; pool->jobs && i < pool->nb_jobs; i++)
+	{
+		pool->jobs[i].in = malloc(HUFFMAN_BLOCK_BOUND);
+		pool->jobs[i].out = malloc(HUFFMAN_BLOCK_BOUND);
+		if (!pool->jobs[i].in || !pool->jobs[i].out)
+			break;
+	}
+	while (pool->jobs && pool->threads && i == pool->nb_jobs &&
+		pool->nb_threads < nb_threads &&
+		!pthread_create(&pool->threads[pool->nb_threads], NULL,
+		pool_worker, pool))
+		pool->nb_threads++;
+	if (pool->nb_threads < nb_threads)
+	{
+		huffman_pool_delete(pool);
+		return (NULL);
+	}
+	return (pool);
+}
+
+/**
+ * huffman_pool_delete - Stops the threads of a block pool and deallocates
+ * it
+ * @pool: Pointer to the pool to delete
+ */
+void huffman_pool_delete(huffman_pool_t *pool)
+{
+	size_t i;
+
+	if (!pool)
+		return;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = 1;
+	pthread_cond_broadcast(&pool->queued);
+	pthread_mutex_unlock(&pool->lock);
+	for (i = 0; i < pool->nb_threads; i++)
+		pthread_join(pool->threads[i], NULL);
+	for (i = 0; pool->jobs && i < pool->nb_jobs; i++)
+	{
+		free(pool->jobs[i].in);
+		free(pool->jobs[i].out);
+		huffman_table_clear(&pool->jobs[i].table);
+	}
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->queued);
+	pthread_cond_destroy(&pool->done);
+	free(pool->jobs);
+	free(pool->threads);
+	free(pool);
+}
+
+/**
+ * huffman_pool_submit - Queues the next job of a block pool
+ * @pool: Pointer to the pool
+ *
+ * Description: The caller fills the slot of the job beforehand, and must
+ * have waited for the job that used the slot before
+ */
+void huffman_pool_submit(huffman_pool_t *pool)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->jobs[pool->nb_queued++ % pool->nb_jobs].state =
+		HUFFMAN_JOB_QUEUED;
+	pthread_cond_signal(&pool->queued);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * huffman_pool_wait - Waits for a job of a block pool to complete
+ * @pool: Pointer to the pool
+ * @job: Number of the job, which must have been queued
+ *
+ * Return: Pointer to the job, its slot is free again once the caller is
+ * done with it
+ */
+huffman_job_t *huffman_pool_wait(huffman_pool_t *pool, size_t job)
+{
+	huffman_job_t *slot = &pool->jobs[job % pool->nb_jobs];
+
+	pthread_mutex_lock(&pool->lock);
+	while (slot->state == HUFFMAN_JOB_QUEUED)
+		pthread_cond_wait(&pool->done, &pool->lock);
+	pthread_mutex_unlock(&pool->lock);
+	return (slot);
+}
@@ -24,17 +24,17 @@ int symbol_cmp(void *p1, void *p2)
 
 /**
  * create_node - Creates a node for the priority queue
- * @data: The character
+ * @data: The symbol
  * @freq: The frequency
  *
  * Return: Pointer to the created node, NULL on failure
  */
-binary_tree_node_t *create_node(char data, size_t freq)
+binary_tree_node_t *create_node(huffman_symbol_t data, size_t freq)
 {
 	binary_tree_node_t *nested_node;
 	symbol_t *symbol;
 
-	/* Create a symbol with the character and its frequency */
+	/* Create a symbol with its frequency */
 	symbol = symbol_create(data, freq);
 	if (!symbol)
 		return (NULL);
@@ -52,42 +52,48 @@ binary_tree_node_t *create_node(char data, size_t freq)
 
 /**
  * huffman_priority_queue - Creates a priority queue for Huffman coding
- * @data: Array of characters
+ * @data: Array of symbols
  * @freq: Array of frequencies
  * @size: Size of the arrays
  *
+ * Description: The heap is built in a single bottom-up pass, in linear
+ * time, rather than by inserting the nodes one at a time
+ *
  * Return: Pointer to the created min heap (priority queue)
  */
-heap_t *huffman_priority_queue(char *data, size_t *freq, size_t size)
+heap_t *huffman_priority_queue(huffman_symbol_t *data, size_t *freq,
+		size_t size)
 {
-	heap_t *priority_queue;
+	heap_t *priority_queue = NULL;
 	binary_tree_node_t *node;
-	size_t i;
+	void **nodes;
+	size_t i, created;
 
-	/* Create the min heap */
-	priority_queue = heap_create(symbol_cmp);
-	if (!priority_queue)
+	nodes = malloc(sizeof(*nodes) * (size + 1));
+	if (!nodes)
 		return (NULL);
 
-	/* For each character, create a node and add it to the min heap */
-	for (i = 0; i < size; i++)
+	/* Create a node for each symbol, then build the heap at once */
+	for (created = 0; created < size; created++)
 	{
-		node = create_node(data[i], freq[i]);
+		node = create_node(data[created], freq[created]);
 		if (!node)
-		{
-			heap_delete(priority_queue, NULL);
-			return (NULL);
-		}
+			break;
+		nodes[created] = node;
+	}
+	if (created == size)
+		priority_queue = heap_create_from_array(symbol_cmp, nodes,
+			size);
 
-		if (heap_insert(priority_queue, node) == NULL)
+	if (!priority_queue)
+	{
+		for (i = 0; i < created; i++)
 		{
-			free(((symbol_t *)(node->data)));
+			node = nodes[i];
+			free(node->data);
 			free(node);
-			heap_delete(priority_queue, NULL);
-			return (NULL);
 		}
 	}
-
+	free(nodes);
 	return (priority_queue);
 }
-
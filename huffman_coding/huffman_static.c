@@ -0,0 +1,26 @@
+#include "huffman.h"
+
+/**
+ * huffman_static_train - Builds the code lengths of a static table from
+ * the histogram of a sample
+ * @freq: Frequency of each of the HUFFMAN_NB_SYMBOLS bytes in the sample
+ * @lengths: Receives the code length of each byte
+ *
+ * Description: Every byte gets a code, those missing from the sample
+ * being counted once, so that any input can be encoded with the table.
+ * The codes are limited to HUFFMAN_TABLE_BITS bits, so that the decoder
+ * has no secondary tables.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_static_train(const size_t *freq, unsigned char *lengths)
+{
+	size_t smoothed[HUFFMAN_NB_SYMBOLS], i;
+
+	if (!freq || !lengths)
+		return (0);
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+		smoothed[i] = freq[i] + 1;
+	return (huffman_code_lengths(smoothed, HUFFMAN_NB_SYMBOLS,
+		HUFFMAN_TABLE_BITS, lengths));
+}
@@ -0,0 +1,906 @@
+/*
+ * Generated by 26-main.c from samples it writes, do not edit:
+ *   ./26-main sample text > text.sample
+ *   ./26-main sample rpc > rpc.sample
+ *   ./26-main train text.sample rpc.sample > huffman_static_tables.c
+ */
+#include "huffman.h"
+
+static const huffman_static_t tables[] = {
+	/* 0: text.sample */
+	{
+		{
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 2, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 4, 6, 7, 6, 4, 5, 11, 4, 4, 11, 11,
+			6, 7, 5, 4, 11, 11, 5, 5, 4, 7, 9, 5,
+			11, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11
+		},
+		{
+			{0x716, 11}, {0x717, 11}, {0x718, 11}, {0x719, 11},
+			{0x71a, 11}, {0x71b, 11}, {0x71c, 11}, {0x71d, 11},
+			{0x71e, 11}, {0x71f, 11}, {0x32, 6}, {0x720, 11},
+			{0x721, 11}, {0x722, 11}, {0x723, 11}, {0x724, 11},
+			{0x725, 11}, {0x726, 11}, {0x727, 11}, {0x728, 11},
+			{0x729, 11}, {0x72a, 11}, {0x72b, 11}, {0x72c, 11},
+			{0x72d, 11}, {0x72e, 11}, {0x72f, 11}, {0x730, 11},
+			{0x731, 11}, {0x732, 11}, {0x733, 11}, {0x734, 11},
+			{0x0, 2}, {0x735, 11}, {0x736, 11}, {0x737, 11},
+			{0x738, 11}, {0x739, 11}, {0x73a, 11}, {0x73b, 11},
+			{0x73c, 11}, {0x73d, 11}, {0x73e, 11}, {0x73f, 11},
+			{0x740, 11}, {0x741, 11}, {0x742, 11}, {0x743, 11},
+			{0x744, 11}, {0x745, 11}, {0x746, 11}, {0x747, 11},
+			{0x748, 11}, {0x749, 11}, {0x74a, 11}, {0x74b, 11},
+			{0x74c, 11}, {0x74d, 11}, {0x74e, 11}, {0x74f, 11},
+			{0x750, 11}, {0x751, 11}, {0x752, 11}, {0x753, 11},
+			{0x754, 11}, {0x755, 11}, {0x756, 11}, {0x757, 11},
+			{0x758, 11}, {0x759, 11}, {0x75a, 11}, {0x75b, 11},
+			{0x38a, 10}, {0x75c, 11}, {0x75d, 11}, {0x75e, 11},
+			{0x75f, 11}, {0x760, 11}, {0x761, 11}, {0x762, 11},
+			{0x763, 11}, {0x764, 11}, {0x765, 11}, {0x766, 11},
+			{0x767, 11}, {0x768, 11}, {0x769, 11}, {0x76a, 11},
+			{0x76b, 11}, {0x76c, 11}, {0x76d, 11}, {0x76e, 11},
+			{0x76f, 11}, {0x770, 11}, {0x771, 11}, {0x772, 11},
+			{0x773, 11}, {0x4, 4}, {0x33, 6}, {0x6e, 7},
+			{0x34, 6}, {0x5, 4}, {0x14, 5}, {0x774, 11},
+			{0x6, 4}, {0x7, 4}, {0x775, 11}, {0x776, 11},
+			{0x35, 6}, {0x6f, 7}, {0x15, 5}, {0x8, 4},
+			{0x777, 11}, {0x778, 11}, {0x16, 5}, {0x17, 5},
+			{0x9, 4}, {0x70, 7}, {0x1c4, 9}, {0x18, 5},
+			{0x779, 11}, {0x36, 6}, {0x77a, 11}, {0x77b, 11},
+			{0x77c, 11}, {0x77d, 11}, {0x77e, 11}, {0x77f, 11},
+			{0x780, 11}, {0x781, 11}, {0x782, 11}, {0x783, 11},
+			{0x784, 11}, {0x785, 11}, {0x786, 11}, {0x787, 11},
+			{0x788, 11}, {0x789, 11}, {0x78a, 11}, {0x78b, 11},
+			{0x78c, 11}, {0x78d, 11}, {0x78e, 11}, {0x78f, 11},
+			{0x790, 11}, {0x791, 11}, {0x792, 11}, {0x793, 11},
+			{0x794, 11}, {0x795, 11}, {0x796, 11}, {0x797, 11},
+			{0x798, 11}, {0x799, 11}, {0x79a, 11}, {0x79b, 11},
+			{0x79c, 11}, {0x79d, 11}, {0x79e, 11}, {0x79f, 11},
+			{0x7a0, 11}, {0x7a1, 11}, {0x7a2, 11}, {0x7a3, 11},
+			{0x7a4, 11}, {0x7a5, 11}, {0x7a6, 11}, {0x7a7, 11},
+			{0x7a8, 11}, {0x7a9, 11}, {0x7aa, 11}, {0x7ab, 11},
+			{0x7ac, 11}, {0x7ad, 11}, {0x7ae, 11}, {0x7af, 11},
+			{0x7b0, 11}, {0x7b1, 11}, {0x7b2, 11}, {0x7b3, 11},
+			{0x7b4, 11}, {0x7b5, 11}, {0x7b6, 11}, {0x7b7, 11},
+			{0x7b8, 11}, {0x7b9, 11}, {0x7ba, 11}, {0x7bb, 11},
+			{0x7bc, 11}, {0x7bd, 11}, {0x7be, 11}, {0x7bf, 11},
+			{0x7c0, 11}, {0x7c1, 11}, {0x7c2, 11}, {0x7c3, 11},
+			{0x7c4, 11}, {0x7c5, 11}, {0x7c6, 11}, {0x7c7, 11},
+			{0x7c8, 11}, {0x7c9, 11}, {0x7ca, 11}, {0x7cb, 11},
+			{0x7cc, 11}, {0x7cd, 11}, {0x7ce, 11}, {0x7cf, 11},
+			{0x7d0, 11}, {0x7d1, 11}, {0x7d2, 11}, {0x7d3, 11},
+			{0x7d4, 11}, {0x7d5, 11}, {0x7d6, 11}, {0x7d7, 11},
+			{0x7d8, 11}, {0x7d9, 11}, {0x7da, 11}, {0x7db, 11},
+			{0x7dc, 11}, {0x7dd, 11}, {0x7de, 11}, {0x7df, 11},
+			{0x7e0, 11}, {0x7e1, 11}, {0x7e2, 11}, {0x7e3, 11},
+			{0x7e4, 11}, {0x7e5, 11}, {0x7e6, 11}, {0x7e7, 11},
+			{0x7e8, 11}, {0x7e9, 11}, {0x7ea, 11}, {0x7eb, 11},
+			{0x7ec, 11}, {0x7ed, 11}, {0x7ee, 11}, {0x7ef, 11},
+			{0x7f0, 11}, {0x7f1, 11}, {0x7f2, 11}, {0x7f3, 11},
+			{0x7f4, 11}, {0x7f5, 11}, {0x7f6, 11}, {0x7f7, 11},
+			{0x7f8, 11}, {0x7f9, 11}, {0x7fa, 11}, {0x7fb, 11},
+			{0x7fc, 11}, {0x7fd, 11}, {0x7fe, 11}, {0x7ff, 11}
+		},
+		{
+			{
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+				0x2002, 0x2002, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6104, 0x6104,
+				0x6104, 0x6104, 0x6104, 0x6104, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6804, 0x6804, 0x6804, 0x6804,
+				0x6804, 0x6804, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6904, 0x6904,
+				0x6904, 0x6904, 0x6904, 0x6904, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04, 0x6f04,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x7404, 0x7404, 0x7404, 0x7404,
+				0x7404, 0x7404, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6605, 0x6605, 0x6605, 0x6605, 0x6605, 0x6605,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x6e05,
+				0x6e05, 0x6e05, 0x6e05, 0x6e05, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x7705, 0x7705,
+				0x7705, 0x7705, 0x7705, 0x7705, 0x0a06, 0x0a06,
+				0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06,
+				0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06,
+				0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06,
+				0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06,
+				0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6406, 0x6406, 0x6406, 0x6406,
+				0x6406, 0x6406, 0x6406, 0x6406, 0x6406, 0x6406,
+				0x6406, 0x6406, 0x6406, 0x6406, 0x6406, 0x6406,
+				0x6406, 0x6406, 0x6406, 0x6406, 0x6406, 0x6406,
+				0x6406, 0x6406, 0x6406, 0x6406, 0x6406, 0x6406,
+				0x6406, 0x6406, 0x6406, 0x6406, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x7906, 0x7906, 0x7906, 0x7906, 0x7906, 0x7906,
+				0x7906, 0x7906, 0x7906, 0x7906, 0x7906, 0x7906,
+				0x7906, 0x7906, 0x7906, 0x7906, 0x7906, 0x7906,
+				0x7906, 0x7906, 0x7906, 0x7906, 0x7906, 0x7906,
+				0x7906, 0x7906, 0x7906, 0x7906, 0x7906, 0x7906,
+				0x7906, 0x7906, 0x6307, 0x6307, 0x6307, 0x6307,
+				0x6307, 0x6307, 0x6307, 0x6307, 0x6307, 0x6307,
+				0x6307, 0x6307, 0x6307, 0x6307, 0x6307, 0x6307,
+				0x6d07, 0x6d07, 0x6d07, 0x6d07, 0x6d07, 0x6d07,
+				0x6d07, 0x6d07, 0x6d07, 0x6d07, 0x6d07, 0x6d07,
+				0x6d07, 0x6d07, 0x6d07, 0x6d07, 0x7507, 0x7507,
+				0x7507, 0x7507, 0x7507, 0x7507, 0x7507, 0x7507,
+				0x7507, 0x7507, 0x7507, 0x7507, 0x7507, 0x7507,
+				0x7507, 0x7507, 0x7609, 0x7609, 0x7609, 0x7609,
+				0x480a, 0x480a, 0x000b, 0x010b, 0x020b, 0x030b,
+				0x040b, 0x050b, 0x060b, 0x070b, 0x080b, 0x090b,
+				0x0b0b, 0x0c0b, 0x0d0b, 0x0e0b, 0x0f0b, 0x100b,
+				0x110b, 0x120b, 0x130b, 0x140b, 0x150b, 0x160b,
+				0x170b, 0x180b, 0x190b, 0x1a0b, 0x1b0b, 0x1c0b,
+				0x1d0b, 0x1e0b, 0x1f0b, 0x210b, 0x220b, 0x230b,
+				0x240b, 0x250b, 0x260b, 0x270b, 0x280b, 0x290b,
+				0x2a0b, 0x2b0b, 0x2c0b, 0x2d0b, 0x2e0b, 0x2f0b,
+				0x300b, 0x310b, 0x320b, 0x330b, 0x340b, 0x350b,
+				0x360b, 0x370b, 0x380b, 0x390b, 0x3a0b, 0x3b0b,
+				0x3c0b, 0x3d0b, 0x3e0b, 0x3f0b, 0x400b, 0x410b,
+				0x420b, 0x430b, 0x440b, 0x450b, 0x460b, 0x470b,
+				0x490b, 0x4a0b, 0x4b0b, 0x4c0b, 0x4d0b, 0x4e0b,
+				0x4f0b, 0x500b, 0x510b, 0x520b, 0x530b, 0x540b,
+				0x550b, 0x560b, 0x570b, 0x580b, 0x590b, 0x5a0b,
+				0x5b0b, 0x5c0b, 0x5d0b, 0x5e0b, 0x5f0b, 0x600b,
+				0x670b, 0x6a0b, 0x6b0b, 0x700b, 0x710b, 0x780b,
+				0x7a0b, 0x7b0b, 0x7c0b, 0x7d0b, 0x7e0b, 0x7f0b,
+				0x800b, 0x810b, 0x820b, 0x830b, 0x840b, 0x850b,
+				0x860b, 0x870b, 0x880b, 0x890b, 0x8a0b, 0x8b0b,
+				0x8c0b, 0x8d0b, 0x8e0b, 0x8f0b, 0x900b, 0x910b,
+				0x920b, 0x930b, 0x940b, 0x950b, 0x960b, 0x970b,
+				0x980b, 0x990b, 0x9a0b, 0x9b0b, 0x9c0b, 0x9d0b,
+				0x9e0b, 0x9f0b, 0xa00b, 0xa10b, 0xa20b, 0xa30b,
+				0xa40b, 0xa50b, 0xa60b, 0xa70b, 0xa80b, 0xa90b,
+				0xaa0b, 0xab0b, 0xac0b, 0xad0b, 0xae0b, 0xaf0b,
+				0xb00b, 0xb10b, 0xb20b, 0xb30b, 0xb40b, 0xb50b,
+				0xb60b, 0xb70b, 0xb80b, 0xb90b, 0xba0b, 0xbb0b,
+				0xbc0b, 0xbd0b, 0xbe0b, 0xbf0b, 0xc00b, 0xc10b,
+				0xc20b, 0xc30b, 0xc40b, 0xc50b, 0xc60b, 0xc70b,
+				0xc80b, 0xc90b, 0xca0b, 0xcb0b, 0xcc0b, 0xcd0b,
+				0xce0b, 0xcf0b, 0xd00b, 0xd10b, 0xd20b, 0xd30b,
+				0xd40b, 0xd50b, 0xd60b, 0xd70b, 0xd80b, 0xd90b,
+				0xda0b, 0xdb0b, 0xdc0b, 0xdd0b, 0xde0b, 0xdf0b,
+				0xe00b, 0xe10b, 0xe20b, 0xe30b, 0xe40b, 0xe50b,
+				0xe60b, 0xe70b, 0xe80b, 0xe90b, 0xea0b, 0xeb0b,
+				0xec0b, 0xed0b, 0xee0b, 0xef0b, 0xf00b, 0xf10b,
+				0xf20b, 0xf30b, 0xf40b, 0xf50b, 0xf60b, 0xf70b,
+				0xf80b, 0xf90b, 0xfa0b, 0xfb0b, 0xfc0b, 0xfd0b,
+				0xfe0b, 0xff0b
+			},
+			NULL,
+			11
+		}
+	},
+	/* 1: rpc.sample */
+	{
+		{
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 3, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 5, 11, 6, 11,
+			5, 6, 5, 6, 6, 6, 6, 6, 6, 6, 5, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 7, 11, 7, 11, 7,
+			11, 5, 6, 5, 5, 4, 6, 11, 7, 5, 7, 7,
+			6, 5, 6, 6, 6, 11, 5, 5, 5, 6, 9, 11,
+			11, 9, 11, 6, 11, 6, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+			11, 11, 11, 11
+		},
+		{
+			{0x728, 11}, {0x729, 11}, {0x72a, 11}, {0x72b, 11},
+			{0x72c, 11}, {0x72d, 11}, {0x72e, 11}, {0x72f, 11},
+			{0x730, 11}, {0x731, 11}, {0x732, 11}, {0x733, 11},
+			{0x734, 11}, {0x735, 11}, {0x736, 11}, {0x737, 11},
+			{0x738, 11}, {0x739, 11}, {0x73a, 11}, {0x73b, 11},
+			{0x73c, 11}, {0x73d, 11}, {0x73e, 11}, {0x73f, 11},
+			{0x740, 11}, {0x741, 11}, {0x742, 11}, {0x743, 11},
+			{0x744, 11}, {0x745, 11}, {0x746, 11}, {0x747, 11},
+			{0x748, 11}, {0x749, 11}, {0x0, 3}, {0x74a, 11},
+			{0x74b, 11}, {0x74c, 11}, {0x74d, 11}, {0x74e, 11},
+			{0x74f, 11}, {0x750, 11}, {0x751, 11}, {0x752, 11},
+			{0x6, 5}, {0x753, 11}, {0x24, 6}, {0x754, 11},
+			{0x7, 5}, {0x25, 6}, {0x8, 5}, {0x26, 6},
+			{0x27, 6}, {0x28, 6}, {0x29, 6}, {0x2a, 6},
+			{0x2b, 6}, {0x2c, 6}, {0x9, 5}, {0x755, 11},
+			{0x756, 11}, {0x757, 11}, {0x758, 11}, {0x759, 11},
+			{0x75a, 11}, {0x75b, 11}, {0x75c, 11}, {0x75d, 11},
+			{0x75e, 11}, {0x75f, 11}, {0x760, 11}, {0x761, 11},
+			{0x762, 11}, {0x763, 11}, {0x764, 11}, {0x765, 11},
+			{0x766, 11}, {0x767, 11}, {0x768, 11}, {0x769, 11},
+			{0x76a, 11}, {0x76b, 11}, {0x76c, 11}, {0x76d, 11},
+			{0x76e, 11}, {0x76f, 11}, {0x770, 11}, {0x771, 11},
+			{0x772, 11}, {0x773, 11}, {0x774, 11}, {0x6c, 7},
+			{0x775, 11}, {0x6d, 7}, {0x776, 11}, {0x6e, 7},
+			{0x777, 11}, {0xa, 5}, {0x2d, 6}, {0xb, 5},
+			{0xc, 5}, {0x2, 4}, {0x2e, 6}, {0x778, 11},
+			{0x6f, 7}, {0xd, 5}, {0x70, 7}, {0x71, 7},
+			{0x2f, 6}, {0xe, 5}, {0x30, 6}, {0x31, 6},
+			{0x32, 6}, {0x779, 11}, {0xf, 5}, {0x10, 5},
+			{0x11, 5}, {0x33, 6}, {0x1c8, 9}, {0x77a, 11},
+			{0x77b, 11}, {0x1c9, 9}, {0x77c, 11}, {0x34, 6},
+			{0x77d, 11}, {0x35, 6}, {0x77e, 11}, {0x77f, 11},
+			{0x780, 11}, {0x781, 11}, {0x782, 11}, {0x783, 11},
+			{0x784, 11}, {0x785, 11}, {0x786, 11}, {0x787, 11},
+			{0x788, 11}, {0x789, 11}, {0x78a, 11}, {0x78b, 11},
+			{0x78c, 11}, {0x78d, 11}, {0x78e, 11}, {0x78f, 11},
+			{0x790, 11}, {0x791, 11}, {0x792, 11}, {0x793, 11},
+			{0x794, 11}, {0x795, 11}, {0x796, 11}, {0x797, 11},
+			{0x798, 11}, {0x799, 11}, {0x79a, 11}, {0x79b, 11},
+			{0x79c, 11}, {0x79d, 11}, {0x79e, 11}, {0x79f, 11},
+			{0x7a0, 11}, {0x7a1, 11}, {0x7a2, 11}, {0x7a3, 11},
+			{0x7a4, 11}, {0x7a5, 11}, {0x7a6, 11}, {0x7a7, 11},
+			{0x7a8, 11}, {0x7a9, 11}, {0x7aa, 11}, {0x7ab, 11},
+			{0x7ac, 11}, {0x7ad, 11}, {0x7ae, 11}, {0x7af, 11},
+			{0x7b0, 11}, {0x7b1, 11}, {0x7b2, 11}, {0x7b3, 11},
+			{0x7b4, 11}, {0x7b5, 11}, {0x7b6, 11}, {0x7b7, 11},
+			{0x7b8, 11}, {0x7b9, 11}, {0x7ba, 11}, {0x7bb, 11},
+			{0x7bc, 11}, {0x7bd, 11}, {0x7be, 11}, {0x7bf, 11},
+			{0x7c0, 11}, {0x7c1, 11}, {0x7c2, 11}, {0x7c3, 11},
+			{0x7c4, 11}, {0x7c5, 11}, {0x7c6, 11}, {0x7c7, 11},
+			{0x7c8, 11}, {0x7c9, 11}, {0x7ca, 11}, {0x7cb, 11},
+			{0x7cc, 11}, {0x7cd, 11}, {0x7ce, 11}, {0x7cf, 11},
+			{0x7d0, 11}, {0x7d1, 11}, {0x7d2, 11}, {0x7d3, 11},
+			{0x7d4, 11}, {0x7d5, 11}, {0x7d6, 11}, {0x7d7, 11},
+			{0x7d8, 11}, {0x7d9, 11}, {0x7da, 11}, {0x7db, 11},
+			{0x7dc, 11}, {0x7dd, 11}, {0x7de, 11}, {0x7df, 11},
+			{0x7e0, 11}, {0x7e1, 11}, {0x7e2, 11}, {0x7e3, 11},
+			{0x7e4, 11}, {0x7e5, 11}, {0x7e6, 11}, {0x7e7, 11},
+			{0x7e8, 11}, {0x7e9, 11}, {0x7ea, 11}, {0x7eb, 11},
+			{0x7ec, 11}, {0x7ed, 11}, {0x7ee, 11}, {0x7ef, 11},
+			{0x7f0, 11}, {0x7f1, 11}, {0x7f2, 11}, {0x7f3, 11},
+			{0x7f4, 11}, {0x7f5, 11}, {0x7f6, 11}, {0x7f7, 11},
+			{0x7f8, 11}, {0x7f9, 11}, {0x7fa, 11}, {0x7fb, 11},
+			{0x7fc, 11}, {0x7fd, 11}, {0x7fe, 11}, {0x7ff, 11}
+		},
+		{
+			{
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x2203, 0x2203,
+				0x2203, 0x2203, 0x2203, 0x2203, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x6504, 0x6504, 0x6504, 0x6504, 0x6504, 0x6504,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x2c05,
+				0x2c05, 0x2c05, 0x2c05, 0x2c05, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3005, 0x3005, 0x3005, 0x3005,
+				0x3005, 0x3005, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3205, 0x3205, 0x3205, 0x3205, 0x3205, 0x3205,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x3a05,
+				0x3a05, 0x3a05, 0x3a05, 0x3a05, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6105, 0x6105, 0x6105, 0x6105,
+				0x6105, 0x6105, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6305, 0x6305, 0x6305, 0x6305, 0x6305, 0x6305,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6405, 0x6405,
+				0x6405, 0x6405, 0x6405, 0x6405, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6905, 0x6905, 0x6905, 0x6905,
+				0x6905, 0x6905, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05, 0x6d05,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
+				0x7205, 0x7205, 0x7205, 0x7205, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7305, 0x7305, 0x7305, 0x7305,
+				0x7305, 0x7305, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x7405, 0x7405, 0x7405, 0x7405, 0x7405, 0x7405,
+				0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06,
+				0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06,
+				0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06,
+				0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06,
+				0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06, 0x2e06,
+				0x2e06, 0x2e06, 0x3106, 0x3106, 0x3106, 0x3106,
+				0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106,
+				0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106,
+				0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106,
+				0x3106, 0x3106, 0x3106, 0x3106, 0x3106, 0x3106,
+				0x3106, 0x3106, 0x3106, 0x3106, 0x3306, 0x3306,
+				0x3306, 0x3306, 0x3306, 0x3306, 0x3306, 0x3306,
+				0x3306, 0x3306, 0x3306, 0x3306, 0x3306, 0x3306,
+				0x3306, 0x3306, 0x3306, 0x3306, 0x3306, 0x3306,
+				0x3306, 0x3306, 0x3306, 0x3306, 0x3306, 0x3306,
+				0x3306, 0x3306, 0x3306, 0x3306, 0x3306, 0x3306,
+				0x3406, 0x3406, 0x3406, 0x3406, 0x3406, 0x3406,
+				0x3406, 0x3406, 0x3406, 0x3406, 0x3406, 0x3406,
+				0x3406, 0x3406, 0x3406, 0x3406, 0x3406, 0x3406,
+				0x3406, 0x3406, 0x3406, 0x3406, 0x3406, 0x3406,
+				0x3406, 0x3406, 0x3406, 0x3406, 0x3406, 0x3406,
+				0x3406, 0x3406, 0x3506, 0x3506, 0x3506, 0x3506,
+				0x3506, 0x3506, 0x3506, 0x3506, 0x3506, 0x3506,
+				0x3506, 0x3506, 0x3506, 0x3506, 0x3506, 0x3506,
+				0x3506, 0x3506, 0x3506, 0x3506, 0x3506, 0x3506,
+				0x3506, 0x3506, 0x3506, 0x3506, 0x3506, 0x3506,
+				0x3506, 0x3506, 0x3506, 0x3506, 0x3606, 0x3606,
+				0x3606, 0x3606, 0x3606, 0x3606, 0x3606, 0x3606,
+				0x3606, 0x3606, 0x3606, 0x3606, 0x3606, 0x3606,
+				0x3606, 0x3606, 0x3606, 0x3606, 0x3606, 0x3606,
+				0x3606, 0x3606, 0x3606, 0x3606, 0x3606, 0x3606,
+				0x3606, 0x3606, 0x3606, 0x3606, 0x3606, 0x3606,
+				0x3706, 0x3706, 0x3706, 0x3706, 0x3706, 0x3706,
+				0x3706, 0x3706, 0x3706, 0x3706, 0x3706, 0x3706,
+				0x3706, 0x3706, 0x3706, 0x3706, 0x3706, 0x3706,
+				0x3706, 0x3706, 0x3706, 0x3706, 0x3706, 0x3706,
+				0x3706, 0x3706, 0x3706, 0x3706, 0x3706, 0x3706,
+				0x3706, 0x3706, 0x3806, 0x3806, 0x3806, 0x3806,
+				0x3806, 0x3806, 0x3806, 0x3806, 0x3806, 0x3806,
+				0x3806, 0x3806, 0x3806, 0x3806, 0x3806, 0x3806,
+				0x3806, 0x3806, 0x3806, 0x3806, 0x3806, 0x3806,
+				0x3806, 0x3806, 0x3806, 0x3806, 0x3806, 0x3806,
+				0x3806, 0x3806, 0x3806, 0x3806, 0x3906, 0x3906,
+				0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
+				0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
+				0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
+				0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
+				0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6206, 0x6206, 0x6206, 0x6206,
+				0x6206, 0x6206, 0x6606, 0x6606, 0x6606, 0x6606,
+				0x6606, 0x6606, 0x6606, 0x6606, 0x6606, 0x6606,
+				0x6606, 0x6606, 0x6606, 0x6606, 0x6606, 0x6606,
+				0x6606, 0x6606, 0x6606, 0x6606, 0x6606, 0x6606,
+				0x6606, 0x6606, 0x6606, 0x6606, 0x6606, 0x6606,
+				0x6606, 0x6606, 0x6606, 0x6606, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06, 0x6c06,
+				0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06,
+				0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06,
+				0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06,
+				0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06,
+				0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06, 0x6e06,
+				0x6e06, 0x6e06, 0x6f06, 0x6f06, 0x6f06, 0x6f06,
+				0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x6f06,
+				0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x6f06,
+				0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x6f06,
+				0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x6f06,
+				0x6f06, 0x6f06, 0x6f06, 0x6f06, 0x7006, 0x7006,
+				0x7006, 0x7006, 0x7006, 0x7006, 0x7006, 0x7006,
+				0x7006, 0x7006, 0x7006, 0x7006, 0x7006, 0x7006,
+				0x7006, 0x7006, 0x7006, 0x7006, 0x7006, 0x7006,
+				0x7006, 0x7006, 0x7006, 0x7006, 0x7006, 0x7006,
+				0x7006, 0x7006, 0x7006, 0x7006, 0x7006, 0x7006,
+				0x7506, 0x7506, 0x7506, 0x7506, 0x7506, 0x7506,
+				0x7506, 0x7506, 0x7506, 0x7506, 0x7506, 0x7506,
+				0x7506, 0x7506, 0x7506, 0x7506, 0x7506, 0x7506,
+				0x7506, 0x7506, 0x7506, 0x7506, 0x7506, 0x7506,
+				0x7506, 0x7506, 0x7506, 0x7506, 0x7506, 0x7506,
+				0x7506, 0x7506, 0x7b06, 0x7b06, 0x7b06, 0x7b06,
+				0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7b06,
+				0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7b06,
+				0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7b06,
+				0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7b06,
+				0x7b06, 0x7b06, 0x7b06, 0x7b06, 0x7d06, 0x7d06,
+				0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06,
+				0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06,
+				0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06,
+				0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06,
+				0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06, 0x7d06,
+				0x5b07, 0x5b07, 0x5b07, 0x5b07, 0x5b07, 0x5b07,
+				0x5b07, 0x5b07, 0x5b07, 0x5b07, 0x5b07, 0x5b07,
+				0x5b07, 0x5b07, 0x5b07, 0x5b07, 0x5d07, 0x5d07,
+				0x5d07, 0x5d07, 0x5d07, 0x5d07, 0x5d07, 0x5d07,
+				0x5d07, 0x5d07, 0x5d07, 0x5d07, 0x5d07, 0x5d07,
+				0x5d07, 0x5d07, 0x5f07, 0x5f07, 0x5f07, 0x5f07,
+				0x5f07, 0x5f07, 0x5f07, 0x5f07, 0x5f07, 0x5f07,
+				0x5f07, 0x5f07, 0x5f07, 0x5f07, 0x5f07, 0x5f07,
+				0x6807, 0x6807, 0x6807, 0x6807, 0x6807, 0x6807,
+				0x6807, 0x6807, 0x6807, 0x6807, 0x6807, 0x6807,
+				0x6807, 0x6807, 0x6807, 0x6807, 0x6a07, 0x6a07,
+				0x6a07, 0x6a07, 0x6a07, 0x6a07, 0x6a07, 0x6a07,
+				0x6a07, 0x6a07, 0x6a07, 0x6a07, 0x6a07, 0x6a07,
+				0x6a07, 0x6a07, 0x6b07, 0x6b07, 0x6b07, 0x6b07,
+				0x6b07, 0x6b07, 0x6b07, 0x6b07, 0x6b07, 0x6b07,
+				0x6b07, 0x6b07, 0x6b07, 0x6b07, 0x6b07, 0x6b07,
+				0x7609, 0x7609, 0x7609, 0x7609, 0x7909, 0x7909,
+				0x7909, 0x7909, 0x000b, 0x010b, 0x020b, 0x030b,
+				0x040b, 0x050b, 0x060b, 0x070b, 0x080b, 0x090b,
+				0x0a0b, 0x0b0b, 0x0c0b, 0x0d0b, 0x0e0b, 0x0f0b,
+				0x100b, 0x110b, 0x120b, 0x130b, 0x140b, 0x150b,
+				0x160b, 0x170b, 0x180b, 0x190b, 0x1a0b, 0x1b0b,
+				0x1c0b, 0x1d0b, 0x1e0b, 0x1f0b, 0x200b, 0x210b,
+				0x230b, 0x240b, 0x250b, 0x260b, 0x270b, 0x280b,
+				0x290b, 0x2a0b, 0x2b0b, 0x2d0b, 0x2f0b, 0x3b0b,
+				0x3c0b, 0x3d0b, 0x3e0b, 0x3f0b, 0x400b, 0x410b,
+				0x420b, 0x430b, 0x440b, 0x450b, 0x460b, 0x470b,
+				0x480b, 0x490b, 0x4a0b, 0x4b0b, 0x4c0b, 0x4d0b,
+				0x4e0b, 0x4f0b, 0x500b, 0x510b, 0x520b, 0x530b,
+				0x540b, 0x550b, 0x560b, 0x570b, 0x580b, 0x590b,
+				0x5a0b, 0x5c0b, 0x5e0b, 0x600b, 0x670b, 0x710b,
+				0x770b, 0x780b, 0x7a0b, 0x7c0b, 0x7e0b, 0x7f0b,
+				0x800b, 0x810b, 0x820b, 0x830b, 0x840b, 0x850b,
+				0x860b, 0x870b, 0x880b, 0x890b, 0x8a0b, 0x8b0b,
+				0x8c0b, 0x8d0b, 0x8e0b, 0x8f0b, 0x900b, 0x910b,
+				0x920b, 0x930b, 0x940b, 0x950b, 0x960b, 0x970b,
+				0x980b, 0x990b, 0x9a0b, 0x9b0b, 0x9c0b, 0x9d0b,
+				0x9e0b, 0x9f0b, 0xa00b, 0xa10b, 0xa20b, 0xa30b,
+				0xa40b, 0xa50b, 0xa60b, 0xa70b, 0xa80b, 0xa90b,
+				0xaa0b, 0xab0b, 0xac0b, 0xad0b, 0xae0b, 0xaf0b,
+				0xb00b, 0xb10b, 0xb20b, 0xb30b, 0xb40b, 0xb50b,
+				0xb60b, 0xb70b, 0xb80b, 0xb90b, 0xba0b, 0xbb0b,
+				0xbc0b, 0xbd0b, 0xbe0b, 0xbf0b, 0xc00b, 0xc10b,
+				0xc20b, 0xc30b, 0xc40b, 0xc50b, 0xc60b, 0xc70b,
+				0xc80b, 0xc90b, 0xca0b, 0xcb0b, 0xcc0b, 0xcd0b,
+				0xce0b, 0xcf0b, 0xd00b, 0xd10b, 0xd20b, 0xd30b,
+				0xd40b, 0xd50b, 0xd60b, 0xd70b, 0xd80b, 0xd90b,
+				0xda0b, 0xdb0b, 0xdc0b, 0xdd0b, 0xde0b, 0xdf0b,
+				0xe00b, 0xe10b, 0xe20b, 0xe30b, 0xe40b, 0xe50b,
+				0xe60b, 0xe70b, 0xe80b, 0xe90b, 0xea0b, 0xeb0b,
+				0xec0b, 0xed0b, 0xee0b, 0xef0b, 0xf00b, 0xf10b,
+				0xf20b, 0xf30b, 0xf40b, 0xf50b, 0xf60b, 0xf70b,
+				0xf80b, 0xf90b, 0xfa0b, 0xfb0b, 0xfc0b, 0xfd0b,
+				0xfe0b, 0xff0b
+			},
+			NULL,
+			11
+		}
+	}
+};
+
+/**
+ * huffman_static_table - Gets a static table, which Huffman blocks can
+ * name by id instead of storing code lengths
+ * @id: Id of the table
+ *
+ * Return: Pointer to the table, or NULL if there is no table with that id
+ */
+const huffman_static_t *huffman_static_table(unsigned int id)
+{
+	if (id >= sizeof(tables) / sizeof(tables[0]))
+		return (NULL);
+	return (&tables[id]);
+}
@@ -0,0 +1,121 @@
+#include "huffman_stream.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * huffman_compress_stream - Compresses everything read from a file
+ * descriptor to another one
+ * @in_fd: File descriptor to read from
+ * @out_fd: File descriptor to write to
+ * @flags: Options, HUFFMAN_FLAG_INTERLEAVED for blocks that decode faster,
+ *   HUFFMAN_FLAG_TANS for blocks that may use tANS when it codes smaller,
+ *   HUFFMAN_FLAG_REUSE for blocks that may reuse the code lengths of the
+ *   Huffman block before
+ *
+ * Description: The input is cut into blocks of HUFFMAN_BLOCK_SIZE bytes,
+ * each with its own codes, so memory use doesn't depend on the size of
+ * the input and the output follows the input a block behind, which lets
+ * it sit in a pipe
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_compress_stream(int in_fd, int out_fd, unsigned int flags)
+{
+	unsigned char *in, *out, end[HUFFMAN_BLOCK_HEADER_SIZE] = {0};
+	huffman_table_t table;
+	size_t size;
+	int ok;
+
+	huffman_table_init(&table);
+	in = malloc(HUFFMAN_BLOCK_SIZE);
+	out = malloc(HUFFMAN_BLOCK_BOUND);
+	ok = in && out;
+	if (ok)
+	{
+		memcpy(out, HUFFMAN_MAGIC, 4);
+		out[4] = HUFFMAN_VERSION;
+		ok = huffman_write_full(out_fd, out,
+			HUFFMAN_STREAM_HEADER_SIZE);
+	}
+	while (ok)
+	{
+		size = huffman_read_full(in_fd, in, HUFFMAN_BLOCK_SIZE);
+		if (size == (size_t)-1)
+			ok = 0;
+		if (!ok || !size)
+			break;
+		ok = huffman_write_full(out_fd, out,
+			huffman_block_compress(in, size, flags,
+			flags & HUFFMAN_FLAG_REUSE ? &table : NULL, out));
+	}
+	if (ok)
+		ok = huffman_write_full(out_fd, end, HUFFMAN_BLOCK_HEADER_SIZE);
+	huffman_table_clear(&table);
+	free(in);
+	free(out);
+	return (ok);
+}
+
+/**
+ * huffman_read_block - Reads a block of a compressed stream
+ * @fd: File descriptor to read from
+ * @block: Buffer receiving the block header and payload, of at least
+ *   HUFFMAN_BLOCK_BOUND bytes
+ *
+ * Return: 1 if a block was read, 0 at the end block, -1 on failure or if
+ * the block is invalid
+ */
+int huffman_read_block(int fd, unsigned char *block)
+{
+	size_t raw_size, size;
+
+	if (huffman_read_full(fd, block, HUFFMAN_BLOCK_HEADER_SIZE) !=
+		HUFFMAN_BLOCK_HEADER_SIZE)
+		return (-1);
+	if (block[0] == HUFFMAN_BLOCK_END)
+		return (0);
+	raw_size = load_be32(block + 1);
+	size = load_be32(block + 5);
+	if (raw_size > HUFFMAN_BLOCK_SIZE || size > HUFFMAN_BLOCK_SIZE ||
+		huffman_read_full(fd, block + HUFFMAN_BLOCK_HEADER_SIZE,
+		size) != size)
+		return (-1);
+	return (1);
+}
+
+/**
+ * huffman_decompress_stream - Decompresses a stream written by
+ * huffman_compress_stream
+ * @in_fd: File descriptor to read from
+ * @out_fd: File descriptor to write to
+ *
+ * Description: Blocks are decoded and written one at a time
+ *
+ * Return: 1 on success, 0 on failure or if the stream is invalid
+ */
+int huffman_decompress_stream(int in_fd, int out_fd)
+{
+	unsigned char *block, *out;
+	huffman_table_t table;
+	int status = -1;
+
+	huffman_table_init(&table);
+	block = malloc(HUFFMAN_BLOCK_BOUND);
+	out = malloc(HUFFMAN_BLOCK_SIZE);
+	if (block && out && huffman_read_full(in_fd, block,
+		HUFFMAN_STREAM_HEADER_SIZE) == HUFFMAN_STREAM_HEADER_SIZE &&
+		!memcmp(block, HUFFMAN_MAGIC, 4) && block[4] == HUFFMAN_VERSION)
+		status = 1;
+	while (status == 1)
+	{
+		status = huffman_read_block(in_fd, block);
+		if (status == 1 && (!huffman_block_decompress(block,
+			block + HUFFMAN_BLOCK_HEADER_SIZE, &table, out) ||
+			!huffman_write_full(out_fd, out, load_be32(block + 1))))
+			status = -1;
+	}
+	huffman_table_clear(&table);
+	free(block);
+	free(out);
+	return (!status);
+}
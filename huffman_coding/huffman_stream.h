@@ -0,0 +1,254 @@
+#ifndef HUFFMAN_STREAM_H
+#define HUFFMAN_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include "huffman_bits.h"
+
+/*
+ * Stream format:
+ *   magic "HUFS", format version
+ *   blocks, each made of a block header followed by its payload
+ *   an end block, its header alone
+ * Block header:
+ *   type (1 byte), uncompressed size (4 bytes), payload size (4 bytes),
+ *   sizes being big-endian
+ *   for Huffman blocks, bits HUFFMAN_TABLE_MASK of the type tell where
+ *   their code lengths are
+ * Payload of a Huffman block:
+ *   code lengths, as told by the type:
+ *     HUFFMAN_TABLE_PACKED: last symbol with a code (1 byte), then code
+ *     length of symbols 0 to the last one, 5 bits each
+ *     HUFFMAN_TABLE_RLE: as written by huffman_lengths_write
+ *     HUFFMAN_TABLE_REUSE: nothing, the lengths of the last Huffman
+ *     block before are used again
+ *     HUFFMAN_TABLE_PREDEFINED: id of a table of huffman_static_table
+ *     (1 byte)
+ *   encoded symbols, the last byte padded with zeros
+ * Payload of an interleaved Huffman block:
+ *   code lengths, as in a Huffman block
+ *   encoded symbols, as written by huffman_encode4
+ * Payload of a tANS block:
+ *   last symbol with a normalized frequency (1 byte)
+ *   normalized frequency of symbols 0 to the last one: its number of
+ *   bits on 4 bits, then its bits but the highest one
+ *   final state of the encoder, on HUFFMAN_TANS_LOG bits, then the bits
+ *   of each symbol, the last byte padded with zeros
+ * Readers that don't know a block type reject the stream.
+ *
+ * Adaptive stream format:
+ *   magic "HUFA", format version
+ *   codes of the bytes, of HUFFMAN_ADAPTIVE_FLUSH and of
+ *   HUFFMAN_ADAPTIVE_END, as given by a huffman_adaptive_t updated after
+ *   each symbol on both ends
+ *   after each flush, zeros up to the next byte boundary
+ *   HUFFMAN_ADAPTIVE_END once, last, then zeros up to the next byte
+ *   boundary. Readers reject a stream that stops before it, or that goes
+ *   on after it.
+ */
+
+#define HUFFMAN_MAGIC "HUFS"
+#define HUFFMAN_VERSION 1
+#define HUFFMAN_STREAM_HEADER_SIZE 5
+#define HUFFMAN_BLOCK_SIZE (128 << 10)
+#define HUFFMAN_BLOCK_HEADER_SIZE 9
+#define HUFFMAN_BLOCK_BOUND (HUFFMAN_BLOCK_HEADER_SIZE + HUFFMAN_BLOCK_SIZE)
+#define HUFFMAN_LENGTH_BITS 5
+
+#define HUFFMAN_ADAPTIVE_MAGIC "HUFA"
+#define HUFFMAN_ADAPTIVE_VERSION 1
+/* Bytes, the symbol ending what a read of the input gave, then the end */
+#define HUFFMAN_ADAPTIVE_SYMBOLS (HUFFMAN_NB_SYMBOLS + 2)
+#define HUFFMAN_ADAPTIVE_FLUSH HUFFMAN_NB_SYMBOLS
+#define HUFFMAN_ADAPTIVE_END (HUFFMAN_NB_SYMBOLS + 1)
+/* Symbols coded before the first rebuild, the interval doubling after */
+#define HUFFMAN_ADAPTIVE_START 16
+#define HUFFMAN_ADAPTIVE_INTERVAL 4096
+/* Sum of the counts from which they are halved */
+#define HUFFMAN_ADAPTIVE_LIMIT (1 << 16)
+/* Largest output of huffman_adaptive_encode for @size bytes */
+#define HUFFMAN_ADAPTIVE_BOUND(size) \
+	(((size) + 1) * HUFFMAN_TABLE_BITS / 8 + 1)
+
+#define HUFFMAN_TABLE_MASK 0x30
+#define HUFFMAN_TABLE_PACKED 0x00
+#define HUFFMAN_TABLE_RLE 0x10
+#define HUFFMAN_TABLE_REUSE 0x20
+#define HUFFMAN_TABLE_PREDEFINED 0x30
+/* Largest code lengths header written by huffman_lengths_write */
+#define HUFFMAN_LENGTHS_BOUND (HUFFMAN_NB_SYMBOLS / 2 + 4)
+
+/**
+ * enum huffman_block_type_e - Types of the blocks of a stream
+ *
+ * @HUFFMAN_BLOCK_END: End of the stream, no payload
+ * @HUFFMAN_BLOCK_RAW: Payload stored as is
+ * @HUFFMAN_BLOCK_HUFFMAN: Payload encoded with canonical Huffman codes
+ * @HUFFMAN_BLOCK_HUFFMAN4: Payload encoded with canonical Huffman codes,
+ *   in HUFFMAN_NB_STREAMS streams decoded side by side
+ * @HUFFMAN_BLOCK_TANS: Payload encoded with table-ANS
+ */
+typedef enum huffman_block_type_e
+{
+	HUFFMAN_BLOCK_END,
+	HUFFMAN_BLOCK_RAW,
+	HUFFMAN_BLOCK_HUFFMAN,
+	HUFFMAN_BLOCK_HUFFMAN4,
+	HUFFMAN_BLOCK_TANS
+} huffman_block_type_t;
+
+/**
+ * struct huffman_table_s - Code lengths of the last Huffman block of a
+ * stream, which the next blocks may reuse
+ *
+ * @lengths: Code length of each byte, all 0 before the first Huffman block
+ * @codes: Codes of @lengths, for the compressor
+ * @decoder: Decoding tables of @lengths, for the decompressor, built the
+ *   first time they are needed, NULL until then
+ */
+typedef struct huffman_table_s
+{
+	unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+	huffman_code_t codes[HUFFMAN_NB_SYMBOLS];
+	huffman_decoder_t *decoder;
+} huffman_table_t;
+
+/**
+ * struct huffman_adaptive_s - Model of an adaptive Huffman coder, whose
+ * codes are rebuilt from the counts of the symbols coded so far
+ *
+ * @freq: Count of each symbol, starting at 1 so that all have a code
+ * @total: Sum of @freq
+ * @left: Symbols to code before the next rebuild
+ * @interval: Symbols coded between the last two rebuilds
+ * @codes: Code of each symbol, at most HUFFMAN_TABLE_BITS bits long
+ * @decode: Entry of the code starting each value of the next
+ *   HUFFMAN_TABLE_BITS bits of input, as in huffman_decoder_t
+ * @ended: 1 once HUFFMAN_ADAPTIVE_END was decoded, 0 before
+ */
+typedef struct huffman_adaptive_s
+{
+	size_t freq[HUFFMAN_ADAPTIVE_SYMBOLS];
+	size_t total;
+	size_t left;
+	size_t interval;
+	huffman_code_t codes[HUFFMAN_ADAPTIVE_SYMBOLS];
+	uint32_t decode[1 << HUFFMAN_TABLE_BITS];
+	int ended;
+} huffman_adaptive_t;
+
+/**
+ * enum huffman_job_state_e - States of a job of a block pool
+ *
+ * @HUFFMAN_JOB_QUEUED: Waiting for a worker, or being worked on
+ * @HUFFMAN_JOB_DONE: Completed
+ * @HUFFMAN_JOB_FAILED: Completed with an error
+ */
+typedef enum huffman_job_state_e
+{
+	HUFFMAN_JOB_QUEUED,
+	HUFFMAN_JOB_DONE,
+	HUFFMAN_JOB_FAILED
+} huffman_job_state_t;
+
+/**
+ * struct huffman_job_s - Block processed by a worker of a block pool
+ *
+ * @in: Input buffer, of HUFFMAN_BLOCK_BOUND bytes
+ * @out: Output buffer, of HUFFMAN_BLOCK_BOUND bytes
+ * @in_size: Number of bytes in @in
+ * @out_size: Number of bytes in @out
+ * @offset: Where the worker reads the block from, -1 if it is already
+ *   in @in
+ * @state: State of the job
+ * @table: Code lengths a block may reuse, left by the worker to those of
+ *   the block if it has some
+ */
+typedef struct huffman_job_s
+{
+	unsigned char *in;
+	unsigned char *out;
+	size_t in_size;
+	size_t out_size;
+	off_t offset;
+	huffman_job_state_t state;
+	huffman_table_t table;
+} huffman_job_t;
+
+/**
+ * struct huffman_pool_s - Threads processing the blocks of a stream
+ *
+ * Jobs are numbered in the order of the blocks. Job n uses the slot
+ * n % @nb_jobs, and workers take jobs in order, so that completed blocks
+ * can be written in order while the next ones are processed.
+ *
+ * @jobs: Slots of the jobs
+ * @nb_jobs: Number of slots
+ * @nb_queued: Number of jobs queued so far
+ * @nb_taken: Number of jobs taken by workers so far
+ * @work: Function processing a job, returning 1 on success, 0 on failure
+ * @fd: File descriptor @work may read blocks from
+ * @flags: Options of the compressor, for @work
+ * @stop: Set when the workers must exit
+ * @lock: Protects @nb_queued, @nb_taken, @stop and the states of the jobs
+ * @queued: Signaled when a job is queued or @stop is set
+ * @done: Signaled when a job is completed
+ * @threads: Worker threads
+ * @nb_threads: Number of worker threads
+ */
+typedef struct huffman_pool_s
+{
+	huffman_job_t *jobs;
+	size_t nb_jobs;
+	size_t nb_queued;
+	size_t nb_taken;
+	int (*work)(const struct huffman_pool_s *pool, huffman_job_t *job);
+	int fd;
+	unsigned int flags;
+	int stop;
+	pthread_mutex_t lock;
+	pthread_cond_t queued;
+	pthread_cond_t done;
+	pthread_t *threads;
+	size_t nb_threads;
+} huffman_pool_t;
+
+void huffman_table_init(huffman_table_t *table);
+void huffman_table_clear(huffman_table_t *table);
+int huffman_table_mode(unsigned int type);
+int huffman_table_set(huffman_table_t *table, const unsigned char *lengths);
+const huffman_decoder_t *huffman_table_decoder(huffman_table_t *table);
+size_t huffman_lengths_write(const unsigned char *lengths, unsigned char *out,
+	size_t out_size);
+size_t huffman_lengths_read(const unsigned char *in, size_t size,
+	unsigned char *lengths);
+size_t huffman_lengths_read_packed(const unsigned char *in, size_t size,
+	unsigned char *lengths);
+size_t huffman_block_compress(const unsigned char *in, size_t in_size,
+	unsigned int flags, huffman_table_t *table, unsigned char *out);
+int huffman_block_decompress(const unsigned char *header,
+	const unsigned char *payload, huffman_table_t *table,
+	unsigned char *out);
+int huffman_adaptive_init(huffman_adaptive_t *model);
+int huffman_adaptive_update(huffman_adaptive_t *model, unsigned int symbol);
+size_t huffman_adaptive_encode(huffman_adaptive_t *model,
+	const unsigned char *in, size_t in_size, unsigned char *out,
+	size_t out_size);
+size_t huffman_adaptive_end(const huffman_adaptive_t *model,
+	unsigned char *out, size_t out_size);
+size_t huffman_adaptive_decode(huffman_adaptive_t *model,
+	bit_reader_t *reader, unsigned char *out, size_t out_size);
+size_t huffman_read_full(int fd, void *buf, size_t size);
+size_t huffman_read_some(int fd, void *buf, size_t size);
+int huffman_write_full(int fd, const void *buf, size_t size);
+size_t huffman_pread_full(int fd, void *buf, size_t size, off_t offset);
+int huffman_read_block(int fd, unsigned char *block);
+huffman_pool_t *huffman_pool_create(size_t nb_threads,
+	int (*work)(const huffman_pool_t *pool, huffman_job_t *job), int fd);
+void huffman_pool_delete(huffman_pool_t *pool);
+void huffman_pool_submit(huffman_pool_t *pool);
+huffman_job_t *huffman_pool_wait(huffman_pool_t *pool, size_t job);
+
+#endif /* HUFFMAN_STREAM_H */
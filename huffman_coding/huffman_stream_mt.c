@@ -0,0 +1,247 @@
+#include "huffman_stream.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * compress_job - Compresses the block of a job
+ * @pool: Pointer to the pool running the job
+ * @job: Pointer to the job
+ *
+ * Return: 1
+ */
+static int compress_job(const huffman_pool_t *pool, huffman_job_t *job)
+{
+	job->out_size = huffman_block_compress(job->in, job->in_size,
+		pool->flags, NULL, job->out);
+	return (1);
+}
+
+/**
+ * decompress_job - Decompresses the block of a job, reading it first if
+ * it is not read yet
+ * @pool: Pointer to the pool running the job
+ * @job: Pointer to the job
+ *
+ * Return: 1 on success, 0 on failure or if the block is invalid
+ */
+static int decompress_job(const huffman_pool_t *pool, huffman_job_t *job)
+{
+	size_t size;
+
+	if (job->offset != -1)
+	{
+		size = huffman_pread_full(pool->fd, job->in,
+			HUFFMAN_BLOCK_HEADER_SIZE, job->offset);
+		if (size != HUFFMAN_BLOCK_HEADER_SIZE)
+			return (0);
+		size = load_be32(job->in + 5);
+		if (size > HUFFMAN_BLOCK_SIZE || huffman_pread_full(pool->fd,
+			job->in + HUFFMAN_BLOCK_HEADER_SIZE, size,
+			job->offset + HUFFMAN_BLOCK_HEADER_SIZE) != size)
+			return (0);
+	}
+	job->out_size = load_be32(job->in + 1);
+	if (job->out_size > HUFFMAN_BLOCK_SIZE)
+		return (0);
+	return (huffman_block_decompress(job->in,
+		job->in + HUFFMAN_BLOCK_HEADER_SIZE, &job->table, job->out));
+}
+
+/**
+ * index_blocks - Builds the offset index of the blocks of a stream
+ * @fd: File descriptor of the stream, at its start
+ * @nb_blocks: Receives the number of blocks
+ *
+ * Description: Only the block headers are read, each giving the offset
+ * of the next one. The offset of @fd is left unchanged.
+ *
+ * Return: Offsets of the blocks, followed by the offset of the end of the
+ * stream, to be freed by the caller, or NULL if @fd is not seekable or the
+ * stream is invalid
+ */
+static off_t *index_blocks(int fd, size_t *nb_blocks)
+{
+	unsigned char header[HUFFMAN_BLOCK_HEADER_SIZE];
+	off_t offset, *offsets = NULL, *tmp;
+	size_t capacity = 0;
+
+	*nb_blocks = 0;
+	offset = lseek(fd, 0, SEEK_CUR);
+	if (offset == -1 || huffman_pread_full(fd, header,
+		HUFFMAN_STREAM_HEADER_SIZE, offset) !=
+		HUFFMAN_STREAM_HEADER_SIZE ||
+		memcmp(header, HUFFMAN_MAGIC, 4) ||
+		header[4] != HUFFMAN_VERSION)
+		return (NULL);
+	for (offset += HUFFMAN_STREAM_HEADER_SIZE;; offset +=
+		HUFFMAN_BLOCK_HEADER_SIZE + load_be32(header + 5))
+	{
+		if (*nb_blocks == capacity)
+		{
+			capacity = capacity ? capacity * 2 : 64;
+			tmp = realloc(offsets, sizeof(*offsets) * capacity);
+			if (!tmp)
+				break;
+			offsets = tmp;
+		}
+		if (huffman_pread_full(fd, header, HUFFMAN_BLOCK_HEADER_SIZE,
+			offset) != HUFFMAN_BLOCK_HEADER_SIZE)
+			break;
+		offsets[*nb_blocks] = offset;
+		if (header[0] == HUFFMAN_BLOCK_END)
+		{
+			offsets[*nb_blocks] += HUFFMAN_BLOCK_HEADER_SIZE;
+			return (offsets);
+		}
+		(*nb_blocks)++;
+	}
+	free(offsets);
+	return (NULL);
+}
+
+/**
+ * huffman_compress_stream_mt - Compresses everything read from a file
+ * descriptor to another one, using several threads
+ * @in_fd: File descriptor to read from
+ * @out_fd: File descriptor to write to
+ * @nb_threads: Number of worker threads
+ * @flags: Options, as for huffman_compress_stream
+ *
+ * Description: The output is the same as huffman_compress_stream's, but
+ * for HUFFMAN_FLAG_REUSE, ignored as it would make each worker wait for
+ * the block before its own. This thread reads the blocks and hands them
+ * to the workers, which compress them, then writes them out in order.
+ * Memory use is two blocks per thread, whatever the size of the input.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int huffman_compress_stream_mt(int in_fd, int out_fd, size_t nb_threads,
+		unsigned int flags)
+{
+	unsigned char header[HUFFMAN_BLOCK_HEADER_SIZE] = HUFFMAN_MAGIC;
+	huffman_pool_t *pool;
+	huffman_job_t *job;
+	size_t queued = 0, written = 0;
+	int ok, eof = 0;
+
+	pool = nb_threads > 1 ? huffman_pool_create(nb_threads, compress_job,
+		in_fd) : NULL;
+	if (!pool)
+		return (huffman_compress_stream(in_fd, out_fd, flags));
+	pool->flags = flags;
+	header[4] = HUFFMAN_VERSION;
+	ok = huffman_write_full(out_fd, header, HUFFMAN_STREAM_HEADER_SIZE);
+	while (ok)
+	{
+		if (!eof && queued - written < pool->nb_jobs)
+		{
+			job = &pool->jobs[queued % pool->nb_jobs];
+			job->in_size = huffman_read_full(in_fd, job->in,
+				HUFFMAN_BLOCK_SIZE);
+			ok = job->in_size != (size_t)-1;
+			eof = !ok || !job->in_size;
+			if (!eof)
+			{
+				huffman_pool_submit(pool);
+				queued++;
+			}
+			continue;
+		}
+		if (written == queued)
+			break;
+		job = huffman_pool_wait(pool, written++);
+		ok = job->state == HUFFMAN_JOB_DONE &&
+			huffman_write_full(out_fd, job->out, job->out_size);
+	}
+	memset(header, HUFFMAN_BLOCK_END, sizeof(header));
+	ok = ok && huffman_write_full(out_fd, header,
+		HUFFMAN_BLOCK_HEADER_SIZE);
+	huffman_pool_delete(pool);
+	return (ok);
+}
+
+/**
+ * huffman_decompress_stream_mt - Decompresses a stream written by
+ * huffman_compress_stream, using several threads
+ * @in_fd: File descriptor to read from
+ * @out_fd: File descriptor to write to
+ * @nb_threads: Number of worker threads
+ *
+ * Description: When @in_fd is seekable, an index of the block offsets is
+ * built from the block headers, and the workers read their blocks
+ * themselves, in parallel, then the offset of @in_fd is moved past the
+ * stream, as huffman_decompress_stream leaves it. Otherwise this thread
+ * reads the blocks in sequence for them. Blocks are written out in
+ * order. A block reusing the code lengths of the Huffman block before is
+ * handed out once the blocks before it are written, with those lengths,
+ * which this thread keeps.
+ *
+ * Return: 1 on success, 0 on failure or if the stream is invalid
+ */
+int huffman_decompress_stream_mt(int in_fd, int out_fd, size_t nb_threads)
+{
+	unsigned char header[HUFFMAN_STREAM_HEADER_SIZE];
+	huffman_pool_t *pool;
+	huffman_job_t *job;
+	huffman_table_t table;
+	off_t *offsets;
+	size_t nb_blocks, queued = 0, written = 0;
+	int status = 1, loaded = 0, mode;
+
+	pool = nb_threads > 1 ? huffman_pool_create(nb_threads, decompress_job,
+		in_fd) : NULL;
+	if (!pool)
+		return (huffman_decompress_stream(in_fd, out_fd));
+	offsets = index_blocks(in_fd, &nb_blocks);
+	if (!offsets && (huffman_read_full(in_fd, header,
+		HUFFMAN_STREAM_HEADER_SIZE) != HUFFMAN_STREAM_HEADER_SIZE ||
+		memcmp(header, HUFFMAN_MAGIC, 4) ||
+		header[4] != HUFFMAN_VERSION))
+		status = -1;
+	huffman_table_init(&table);
+	while (status != -1)
+	{
+		job = &pool->jobs[queued % pool->nb_jobs];
+		if (status == 1 && !loaded && queued - written < pool->nb_jobs)
+		{
+			job->offset = offsets && queued < nb_blocks ?
+				offsets[queued] : -1;
+			if (!offsets)
+				status = huffman_read_block(in_fd, job->in);
+			else if (queued == nb_blocks)
+				status = 0;
+			if (status == 1 && offsets && huffman_pread_full(in_fd,
+				job->in, 1, job->offset) != 1)
+				status = -1;
+			mode = huffman_table_mode(job->in[0]);
+			loaded = status != 1 ? 0 :
+				1 + (mode == HUFFMAN_TABLE_REUSE);
+		}
+		if (loaded == 1 || (loaded == 2 && written == queued))
+		{
+			if (loaded == 2)
+				huffman_table_set(&job->table, table.lengths);
+			huffman_pool_submit(pool);
+			queued++;
+			loaded = 0;
+			continue;
+		}
+		if (written == queued)
+			break;
+		job = huffman_pool_wait(pool, written++);
+		if (job->state != HUFFMAN_JOB_DONE ||
+			!huffman_write_full(out_fd, job->out, job->out_size))
+			status = -1;
+		mode = huffman_table_mode(job->in[0]);
+		if (mode != -1 && mode != HUFFMAN_TABLE_REUSE)
+			huffman_table_set(&table, job->table.lengths);
+	}
+	if (status == 0 && offsets &&
+		lseek(in_fd, offsets[nb_blocks], SEEK_SET) == -1)
+		status = -1;
+	huffman_table_clear(&table);
+	free(offsets);
+	huffman_pool_delete(pool);
+	return (status == 0);
+}
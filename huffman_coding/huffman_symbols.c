@@ -0,0 +1,120 @@
+#include "huffman_bits.h"
+
+/**
+ * huffman_encode_symbols - Encodes symbols of any alphabet with Huffman
+ * codes
+ * @codes: Table of the codes, indexed by symbol
+ * @in: Symbols to encode, each must have a code
+ * @in_size: Number of symbols to encode
+ * @out: Buffer receiving the encoded bits, most significant first, the
+ *   last byte padded with zeros
+ * @out_size: Size of @out
+ *
+ * Return: Number of bytes written, or 0 if @out is too small or a symbol
+ * has no code
+ */
+size_t huffman_encode_symbols(const huffman_code_t *codes,
+		const huffman_symbol_t *in, size_t in_size, unsigned char *out,
+		size_t out_size)
+{
+	bit_writer_t writer;
+	size_t i;
+
+	if (!codes || !in || !out)
+		return (0);
+	writer.out = out;
+	writer.end = out + out_size;
+	writer.acc = 0;
+	writer.count = 0;
+	writer.overflow = 0;
+	for (i = 0; i < in_size && !writer.overflow; i++)
+	{
+		if (!codes[in[i]].length ||
+			codes[in[i]].length > HUFFMAN_MAX_CODE_LENGTH)
+			return (0);
+		bit_write(&writer, codes[in[i]].bits, codes[in[i]].length);
+	}
+	bit_flush(&writer);
+	if (writer.overflow)
+		return (0);
+	return (writer.out - out);
+}
+
+/**
+ * decode_symbols_checked - Decodes symbols one at a time, checking each
+ * code
+ * @decoder: Pointer to the decoding tables of the codes
+ * @reader: Pointer to the bit reader
+ * @out: Buffer receiving the decoded symbols
+ * @end: End of @out
+ *
+ * Return: 1 on success, 0 if the input is invalid or too short
+ */
+static int decode_symbols_checked(const huffman_decoder_t *decoder,
+		bit_reader_t *reader, huffman_symbol_t *out,
+		huffman_symbol_t *end)
+{
+	unsigned int length;
+	uint32_t entry;
+
+	while (out < end)
+	{
+		bit_refill(reader);
+		entry = huffman_decode_entry(decoder, reader->buf);
+		length = entry & 0x3f;
+		if (!length || length > reader->count)
+			return (0);
+		*out++ = entry >> 8;
+		reader->buf <<= length;
+		reader->count -= length;
+	}
+	return (1);
+}
+
+/**
+ * huffman_decode_symbols - Decodes symbols of any alphabet encoded with
+ * canonical Huffman codes
+ * @decoder: Pointer to the decoding tables of the codes
+ * @in: Encoded bits, most significant first
+ * @in_size: Number of bytes of @in
+ * @out: Buffer receiving the decoded symbols
+ * @out_size: Number of symbols to decode
+ *
+ * Description: Works as huffman_decode does, the entries of the decoder
+ * holding symbols of up to 24 bits
+ *
+ * Return: 1 on success, 0 if the input is invalid or too short
+ */
+int huffman_decode_symbols(const huffman_decoder_t *decoder,
+		const unsigned char *in, size_t in_size, huffman_symbol_t *out,
+		size_t out_size)
+{
+	bit_reader_t reader;
+	huffman_symbol_t *end = out + out_size;
+	unsigned int per_refill, k, length, invalid = 0;
+	uint32_t entry;
+
+	if (!decoder || !in || !out || !decoder->max_length)
+		return (!out_size);
+	reader.in = in;
+	reader.end = in + in_size;
+	reader.buf = 0;
+	reader.count = 0;
+	per_refill = 56 / decoder->max_length;
+	while ((size_t)(end - out) >= per_refill && reader.end - reader.in >= 8)
+	{
+		bit_refill(&reader);
+		for (k = 0; k < per_refill; k++)
+		{
+			entry = huffman_decode_entry(decoder, reader.buf);
+			length = entry & 0x3f;
+			invalid |= !length;
+			*out++ = entry >> 8;
+			reader.buf <<= length;
+			reader.count -= length;
+		}
+	}
+	if (invalid)
+		return (0);
+	return (decode_symbols_checked(decoder, &reader, out, end));
+}
@@ -0,0 +1,82 @@
+#include "huffman_stream.h"
+#include <string.h>
+
+/**
+ * huffman_table_init - Initializes the code lengths a stream's blocks may
+ * reuse, before its first block
+ * @table: Pointer to the table
+ */
+void huffman_table_init(huffman_table_t *table)
+{
+	memset(table->lengths, 0, sizeof(table->lengths));
+	memset(table->codes, 0, sizeof(table->codes));
+	table->decoder = NULL;
+}
+
+/**
+ * huffman_table_clear - Deallocates the decoding tables of a table and
+ * initializes it again
+ * @table: Pointer to the table
+ */
+void huffman_table_clear(huffman_table_t *table)
+{
+	huffman_decoder_delete(table->decoder);
+	huffman_table_init(table);
+}
+
+/**
+ * huffman_table_mode - Tells where a block takes its code lengths from
+ * @type: Type of the block, as in its header
+ *
+ * Return: HUFFMAN_TABLE_* mode of the block, or -1 if it is not a Huffman
+ * block
+ */
+int huffman_table_mode(unsigned int type)
+{
+	unsigned int base = type & ~HUFFMAN_TABLE_MASK;
+
+	if (base != HUFFMAN_BLOCK_HUFFMAN && base != HUFFMAN_BLOCK_HUFFMAN4)
+		return (-1);
+	return (type & HUFFMAN_TABLE_MASK);
+}
+
+/**
+ * huffman_table_set - Replaces the code lengths of a table
+ * @table: Pointer to the table
+ * @lengths: Code length of each of the HUFFMAN_NB_SYMBOLS bytes
+ *
+ * Description: Setting the lengths a table already has keeps its codes
+ * and decoding tables, so that blocks using the same lengths one after
+ * the other build them once
+ *
+ * Return: 1 on success, 0 if the lengths don't make a prefix code
+ */
+int huffman_table_set(huffman_table_t *table, const unsigned char *lengths)
+{
+	if (!memcmp(table->lengths, lengths, sizeof(table->lengths)))
+		return (1);
+	if (!huffman_canonical_codes(lengths, HUFFMAN_NB_SYMBOLS, table->codes))
+	{
+		huffman_table_clear(table);
+		return (0);
+	}
+	memcpy(table->lengths, lengths, sizeof(table->lengths));
+	huffman_decoder_delete(table->decoder);
+	table->decoder = NULL;
+	return (1);
+}
+
+/**
+ * huffman_table_decoder - Gets the decoding tables of a table
+ * @table: Pointer to the table
+ *
+ * Return: Pointer to the decoding tables, built if they weren't yet, or
+ * NULL on failure
+ */
+const huffman_decoder_t *huffman_table_decoder(huffman_table_t *table)
+{
+	if (!table->decoder)
+		table->decoder = huffman_decoder_create(table->lengths,
+			HUFFMAN_NB_SYMBOLS);
+	return (table->decoder);
+}
@@ -0,0 +1,165 @@
+#include "huffman.h"
+
+/* Step spreading the symbols over the states, odd so it visits them all */
+#define TANS_STEP ((HUFFMAN_TANS_SIZE >> 1) + (HUFFMAN_TANS_SIZE >> 3) + 3)
+
+/**
+ * log2_fixed - Computes a base 2 logarithm in fixed point
+ * @x: Positive integer
+ *
+ * Description: The integer part is the index of the highest bit. The
+ * fractional bits come one at a time, by squaring the mantissa kept in
+ * [1, 2) with 30 fractional bits: it reaches 2 when the next bit is set.
+ *
+ * Return: log2(@x) with 16 fractional bits
+ */
+static uint32_t log2_fixed(uint32_t x)
+{
+	uint32_t result = 0, bit;
+	uint64_t y;
+
+	while (x >> (result + 1))
+		result++;
+	y = (uint64_t)x << 30 >> result;
+	result <<= 16;
+	for (bit = 16; bit-- > 0;)
+	{
+		y = y * y >> 30;
+		if (y >= (uint64_t)2 << 30)
+		{
+			y >>= 1;
+			result |= 1U << bit;
+		}
+	}
+	return (result);
+}
+
+/**
+ * huffman_tans_normalize - Scales the frequencies of bytes so that they
+ * sum to HUFFMAN_TANS_SIZE
+ * @freq: Frequency of each of the HUFFMAN_NB_SYMBOLS bytes
+ * @counts: Receives the normalized frequencies
+ *
+ * Description: Each frequency is rounded, a byte that occurs keeping at
+ * least 1. The rounding error is then taken from or given to the largest
+ * counts, which it costs the least.
+ *
+ * Return: 1 on success, 0 if no byte occurs
+ */
+int huffman_tans_normalize(const size_t *freq, uint16_t *counts)
+{
+	size_t total = 0, sum = 0, i, largest, excess;
+
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+		total += freq[i];
+	if (!total)
+		return (0);
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+	{
+		counts[i] = (freq[i] * HUFFMAN_TANS_SIZE + total / 2) / total;
+		if (freq[i] && !counts[i])
+			counts[i] = 1;
+		sum += counts[i];
+	}
+	while (sum != HUFFMAN_TANS_SIZE)
+	{
+		for (largest = 0, i = 1; i < HUFFMAN_NB_SYMBOLS; i++)
+			if (counts[i] > counts[largest])
+				largest = i;
+		if (sum < HUFFMAN_TANS_SIZE)
+		{
+			counts[largest] += HUFFMAN_TANS_SIZE - sum;
+			break;
+		}
+		excess = sum - HUFFMAN_TANS_SIZE;
+		if (excess > counts[largest] / 2U)
+			excess = counts[largest] / 2U;
+		counts[largest] -= excess;
+		sum -= excess;
+	}
+	return (1);
+}
+
+/**
+ * huffman_tans_cost - Estimates the size of a tANS payload
+ * @freq: Frequency of each of the HUFFMAN_NB_SYMBOLS bytes
+ * @counts: Normalized frequencies, as given by huffman_tans_normalize
+ *
+ * Description: A byte of normalized frequency c costs log2(size / c)
+ * bits, fractions of bits included, which is where tANS beats Huffman
+ * codes on skewed data
+ *
+ * Return: Size of the payload in bytes, header included
+ */
+size_t huffman_tans_cost(const size_t *freq, const uint16_t *counts)
+{
+	uint64_t bits = 0;
+	size_t header = 0, last = 0, i;
+	uint32_t length;
+
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+	{
+		if (!counts[i])
+			continue;
+		bits += (uint64_t)freq[i] *
+			((HUFFMAN_TANS_LOG << 16) - log2_fixed(counts[i]));
+		for (length = 0; counts[i] >> length; length++)
+			;
+		header += length - 1;
+		last = i;
+	}
+	header += 8 + (last + 1) * HUFFMAN_TANS_COUNT_BITS;
+	return ((header + 7) / 8 + ((bits >> 16) + HUFFMAN_TANS_LOG + 7) / 8);
+}
+
+/**
+ * huffman_tans_init - Builds the tables of a tANS coder
+ * @tans: Pointer to the tables to build
+ * @counts: Normalized frequency of each of the HUFFMAN_NB_SYMBOLS bytes
+ *
+ * Description: The states of each byte are spread over the table, so
+ * that each byte comes back regularly whatever the state. The k-th state
+ * of a byte of count c decodes to the sub-state c + k, which reads the
+ * bits that bring it back into the range of the states.
+ *
+ * Return: 1 on success, 0 if the counts don't sum to HUFFMAN_TANS_SIZE
+ */
+int huffman_tans_init(huffman_tans_t *tans, const uint16_t *counts)
+{
+	unsigned char spread[HUFFMAN_TANS_SIZE];
+	uint16_t next[HUFFMAN_NB_SYMBOLS];
+	size_t s, i, pos = 0, sum = 0;
+	uint32_t y, bits;
+
+	for (s = 0; s < HUFFMAN_NB_SYMBOLS; s++)
+	{
+		tans->counts[s] = next[s] = counts[s];
+		tans->start[s] = sum;
+		sum += counts[s];
+		bits = 0;
+		while (counts[s] && counts[s] << bits < HUFFMAN_TANS_SIZE)
+			bits++;
+		tans->bits[s] = bits;
+		tans->threshold[s] = (uint32_t)counts[s] << bits;
+	}
+	if (sum != HUFFMAN_TANS_SIZE)
+		return (0);
+	for (s = 0; s < HUFFMAN_NB_SYMBOLS; s++)
+		for (i = 0; i < counts[s]; i++)
+		{
+			spread[pos] = s;
+			pos = (pos + TANS_STEP) & (HUFFMAN_TANS_SIZE - 1);
+		}
+	for (i = 0; i < HUFFMAN_TANS_SIZE; i++)
+	{
+		s = spread[i];
+		y = next[s]++;
+		for (bits = 0; y << bits < HUFFMAN_TANS_SIZE; bits++)
+			;
+		tans->decode[i] = ((y << bits) - HUFFMAN_TANS_SIZE) << 16 |
+			bits << 8 | s;
+		tans->encode[tans->start[s] + y - counts[s]] =
+			HUFFMAN_TANS_SIZE + i;
+	}
+	return (1);
+}
@@ -0,0 +1,134 @@
+#include "huffman_bits.h"
+#include <string.h>
+
+/**
+ * write_counts - Writes the normalized frequencies of a tANS payload
+ * @counts: Normalized frequency of each byte
+ * @out: Buffer receiving the frequencies
+ * @out_size: Size of @out
+ *
+ * Description: Each frequency up to the last byte that occurs is written
+ * as its number of bits, on HUFFMAN_TANS_COUNT_BITS bits, followed by its
+ * bits but the highest one
+ *
+ * Return: Number of bytes written, or 0 if @out is too small
+ */
+static size_t write_counts(const uint16_t *counts, unsigned char *out,
+		size_t out_size)
+{
+	bit_writer_t writer;
+	unsigned int last, i, length;
+
+	for (last = HUFFMAN_NB_SYMBOLS - 1; last > 0 && !counts[last]; last--)
+		;
+	if (!out_size)
+		return (0);
+	out[0] = last;
+	writer.out = out + 1;
+	writer.end = out + out_size;
+	writer.acc = 0;
+	writer.count = 0;
+	writer.overflow = 0;
+	for (i = 0; i <= last; i++)
+	{
+		for (length = 0; counts[i] >> length; length++)
+			;
+		bit_write(&writer, length, HUFFMAN_TANS_COUNT_BITS);
+		if (length > 1)
+			bit_write(&writer, counts[i] - (1U << (length - 1)),
+				length - 1);
+	}
+	bit_flush(&writer);
+	return (writer.overflow ? 0 : (size_t)(writer.out - out));
+}
+
+/**
+ * read_counts - Reads the normalized frequencies of a tANS payload
+ * @in: Payload
+ * @size: Size of the payload
+ * @counts: Receives the normalized frequency of each byte
+ *
+ * Return: Number of bytes read, or 0 if the payload is invalid
+ */
+static size_t read_counts(const unsigned char *in, size_t size,
+		uint16_t *counts)
+{
+	bit_reader_t reader;
+	unsigned int last, i, length;
+
+	if (!size)
+		return (0);
+	memset(counts, 0, sizeof(*counts) * HUFFMAN_NB_SYMBOLS);
+	last = in[0];
+	reader.in = in + 1;
+	reader.end = in + size;
+	reader.buf = 0;
+	reader.count = 0;
+	for (i = 0; i <= last; i++)
+	{
+		bit_refill(&reader);
+		if (reader.count < HUFFMAN_TANS_COUNT_BITS)
+			return (0);
+		length = reader.buf >> (64 - HUFFMAN_TANS_COUNT_BITS);
+		reader.buf <<= HUFFMAN_TANS_COUNT_BITS;
+		reader.count -= HUFFMAN_TANS_COUNT_BITS;
+		if (length > HUFFMAN_TANS_LOG + 1 ||
+			length > reader.count + 1)
+			return (0);
+		if (!length)
+			continue;
+		counts[i] = 1U << (length - 1) |
+			(uint32_t)(reader.buf >> 1 >> (64 - length));
+		reader.buf <<= length - 1;
+		reader.count -= length - 1;
+	}
+	return (reader.in - in - reader.count / 8);
+}
+
+/**
+ * huffman_tans_compress - Writes the payload of a tANS block
+ * @in: Bytes to compress
+ * @in_size: Number of bytes
+ * @counts: Normalized frequency of each byte, as given by
+ *   huffman_tans_normalize
+ * @out: Buffer receiving the payload
+ * @out_size: Size of @out
+ *
+ * Return: Number of bytes written, or 0 on failure or if @out is too small
+ */
+size_t huffman_tans_compress(const unsigned char *in, size_t in_size,
+		const uint16_t *counts, unsigned char *out, size_t out_size)
+{
+	huffman_tans_t tans;
+	size_t header, size;
+
+	header = write_counts(counts, out, out_size);
+	if (!header || !huffman_tans_init(&tans, counts))
+		return (0);
+	size = huffman_tans_encode(&tans, in, in_size, out + header,
+		out_size - header);
+	return (size ? header + size : 0);
+}
+
+/**
+ * huffman_tans_decompress - Decodes the payload of a tANS block
+ * @in: Payload
+ * @in_size: Size of the payload
+ * @out: Buffer receiving the bytes
+ * @out_size: Number of bytes to decode
+ *
+ * Return: 1 on success, 0 if the payload is invalid
+ */
+int huffman_tans_decompress(const unsigned char *in, size_t in_size,
+		unsigned char *out, size_t out_size)
+{
+	uint16_t counts[HUFFMAN_NB_SYMBOLS];
+	huffman_tans_t tans;
+	size_t header;
+
+	header = read_counts(in, in_size, counts);
+	if (!header || !huffman_tans_init(&tans, counts))
+		return (0);
+	return (huffman_tans_decode(&tans, in + header, in_size - header, out,
+		out_size));
+}
@@ -0,0 +1,99 @@
+#include "huffman_bits.h"
+#include <stdlib.h>
+
+/**
+ * huffman_tans_encode - Encodes bytes with a tANS coder
+ * @tans: Pointer to the tables of the coder
+ * @in: Bytes to encode, each one with a normalized frequency
+ * @in_size: Number of bytes
+ * @out: Buffer receiving the encoded bits
+ * @out_size: Size of @out
+ *
+ * Description: The bytes are encoded from the last one, so that the
+ * decoder gets them back from the first one. The bits written for each
+ * byte are kept aside and written in the order the decoder reads them,
+ * after the final state.
+ *
+ * Return: Number of bytes written, or 0 on failure or if @out is too small
+ */
+size_t huffman_tans_encode(const huffman_tans_t *tans, const unsigned char *in,
+		size_t in_size, unsigned char *out, size_t out_size)
+{
+	bit_writer_t writer;
+	uint16_t *chunks;
+	uint32_t state = HUFFMAN_TANS_SIZE, bits;
+	size_t i;
+
+	chunks = malloc(sizeof(*chunks) * (in_size ? in_size : 1));
+	if (!chunks)
+		return (0);
+	for (i = in_size; i-- > 0;)
+	{
+		bits = tans->bits[in[i]] - (state < tans->threshold[in[i]]);
+		chunks[i] = (state & ((1U << bits) - 1)) << 4 | bits;
+		state = tans->encode[tans->start[in[i]] + (state >> bits) -
+			tans->counts[in[i]]];
+	}
+	writer.out = out;
+	writer.end = out + out_size;
+	writer.acc = 0;
+	writer.count = 0;
+	writer.overflow = 0;
+	bit_write(&writer, state - HUFFMAN_TANS_SIZE, HUFFMAN_TANS_LOG);
+	for (i = 0; i < in_size && !writer.overflow; i++)
+		bit_write(&writer, chunks[i] >> 4, chunks[i] & 0xf);
+	bit_flush(&writer);
+	free(chunks);
+	return (writer.overflow ? 0 : (size_t)(writer.out - out));
+}
+
+/**
+ * huffman_tans_decode - Decodes bytes encoded with a tANS coder
+ * @tans: Pointer to the tables of the coder
+ * @in: Encoded bits
+ * @in_size: Number of bytes of @in
+ * @out: Buffer receiving the decoded bytes
+ * @out_size: Number of bytes to decode
+ *
+ * Description: Each byte takes one lookup in the decoding table, and at
+ * most HUFFMAN_TANS_LOG bits of input, so the bit buffer is refilled once
+ * every 4 bytes
+ *
+ * Return: 1 on success, 0 if the input is invalid or too short
+ */
+int huffman_tans_decode(const huffman_tans_t *tans, const unsigned char *in,
+		size_t in_size, unsigned char *out, size_t out_size)
+{
+	bit_reader_t reader;
+	unsigned char *end = out + out_size;
+	uint32_t state, entry, bits;
+	int i;
+
+	reader.in = in;
+	reader.end = in + in_size;
+	reader.buf = 0;
+	reader.count = 0;
+	bit_refill(&reader);
+	if (reader.count < HUFFMAN_TANS_LOG)
+		return (0);
+	state = reader.buf >> (64 - HUFFMAN_TANS_LOG);
+	reader.buf <<= HUFFMAN_TANS_LOG;
+	reader.count -= HUFFMAN_TANS_LOG;
+	while (out < end)
+	{
+		bit_refill(&reader);
+		for (i = 0; i < 4 && out < end; i++)
+		{
+			entry = tans->decode[state];
+			bits = entry >> 8 & 0xff;
+			if (bits > reader.count)
+				return (0);
+			*out++ = (unsigned char)entry;
+			state = (entry >> 16) +
+				(uint32_t)(reader.buf >> 1 >> (63 - bits));
+			reader.buf <<= bits;
+			reader.count -= bits;
+		}
+	}
+	return (1);
+}
@@ -0,0 +1,92 @@
+#include "huffman.h"
+#include "heap/heap.h"
+#include <stdlib.h>
+
+/**
+ * tree_node_cmp - Compares two tree nodes based on the frequencies of
+ * their symbols
+ * @p1: First node
+ * @p2: Second node
+ *
+ * Description: Ties are broken the way huffman_code_lengths breaks them,
+ * so both build the same tree: leaves come before merged nodes, leaves
+ * in the order of the symbols, and merged nodes in the order they were
+ * created, that is from the end of the block towards the start
+ *
+ * Return: Negative, zero or positive if the first node is to be merged
+ * before, at the same time or after the second one
+ */
+static int tree_node_cmp(void *p1, void *p2)
+{
+	binary_tree_node_t *node1 = p1, *node2 = p2;
+	size_t freq1, freq2;
+
+	freq1 = ((symbol_t *)node1->data)->freq;
+	freq2 = ((symbol_t *)node2->data)->freq;
+	if (freq1 != freq2)
+		return (freq1 < freq2 ? -1 : 1);
+	if (!node1->left != !node2->left)
+		return (node1->left ? 1 : -1);
+	if (node1->left)
+		return ((node1 < node2) - (node1 > node2));
+	return ((node1 > node2) - (node1 < node2));
+}
+
+/**
+ * huffman_tree - Builds the Huffman tree of a set of symbols
+ * @data: Array of symbols
+ * @freq: Array of frequencies
+ * @size: Size of the arrays
+ *
+ * Description: The nodes come from a node pool, so building the tree
+ * takes a single allocation, plus the queue's, and the whole tree is
+ * deallocated with a single free of the root. As with
+ * huffman_code_lengths, symbols of frequency 0 are left out of the tree
+ * and get no code, and a tree with a single symbol is that leaf alone.
+ *
+ * Return: Pointer to the root of the tree, or NULL on failure or if every
+ * frequency is 0
+ */
+binary_tree_node_t *huffman_tree(huffman_symbol_t *data, size_t *freq,
+		size_t size)
+{
+	huffman_node_pool_t pool;
+	binary_tree_node_t *left, *right;
+	array_heap_t *queue;
+	size_t i, merged, leaves = 0;
+
+	if (!huffman_node_pool_init(&pool, data, freq, size))
+		return (NULL);
+	queue = array_heap_create(tree_node_cmp);
+	for (i = 0; queue && i < size; i++)
+	{
+		if (!freq[i])
+			continue;
+		leaves++;
+		if (!array_heap_insert(queue, &pool.nodes[size - 1 + i]))
+			break;
+	}
+	/* Merges end at node 0 whatever the number of leaves */
+	pool.next = leaves ? leaves - 1 : 0;
+	if (leaves == 1 && i == size)
+	{
+		left = array_heap_extract(queue);
+		pool.nodes[0] = *left;
+	}
+	while (queue && i == size && pool.next)
+	{
+		left = array_heap_extract(queue);
+		right = array_heap_extract(queue);
+		merged = huffman_node_pool_merge(&pool, left - pool.nodes,
+			right - pool.nodes);
+		/* Cannot fail, two nodes were just extracted */
+		array_heap_insert(queue, &pool.nodes[merged]);
+	}
+	array_heap_delete(queue, NULL);
+	if (!queue || i < size || !leaves)
+	{
+		free(pool.nodes);
+		return (NULL);
+	}
+	return (pool.nodes);
+}
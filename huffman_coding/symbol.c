@@ -8,7 +8,7 @@
  *
  * Return: A pointer to the created structure, or NULL if it fails
  */
-symbol_t *symbol_create(char data, size_t freq)
+symbol_t *symbol_create(huffman_symbol_t data, size_t freq)
 {
 	symbol_t *symbol;
 
@@ -19,6 +19,7 @@ symbol_t *symbol_create(char data, size_t freq)
 
 	/* Initialize the structure fields */
 	symbol->data = data;
+	symbol->internal = 0;
 	symbol->freq = freq;
 
 	return (symbol);